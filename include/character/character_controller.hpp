@@ -0,0 +1,262 @@
+#pragma once
+#ifndef SIM_CHARACTER_CONTROLLER_HPP
+#define SIM_CHARACTER_CONTROLLER_HPP
+// include/character/character_controller.hpp
+// Kinematic character controller: move-and-slide, step-up, slope limit
+//
+// Design notes:
+//  - One broadphase query per move(): the swept region (plus step and
+//    probe room) is gathered once and every slide, step and ground cast
+//    runs against that candidate list
+//  - Ground state is cached together with the (collider, revision) list
+//    it was computed from and the broadphase stamp of the probe region.
+//    An idle character on static ground never re-queries anything
+//  - Surfaces steeper than max_slope behave as walls: sliding on them
+//    may go down but never up, and they trigger step-up instead
+
+#include "../collision/collider.hpp"
+#include "../collision/shape_cast.hpp"
+#include <cmath>      // std::cos
+#include <cstdint>
+#include <utility>    // std::pair
+#include <vector>
+
+namespace sim {
+
+struct CharacterConfig {
+  ConvexProxy shape{make_capsule(Vec2{0.0, -0.5}, Vec2{0.0, 0.5}, 0.3)};  ///< local to position
+  double skin{0.01};            ///< gap kept between the shape and the world
+  double step_height{0.25};
+  double max_slope{0.8727};     ///< steepest walkable slope (radians, ~50 deg)
+  double ground_probe{0.05};    ///< how far below the skin ground is searched
+  int max_slide_iterations{4};
+  double cache_tolerance{1e-9}; ///< position change that invalidates the ground cache
+};
+
+struct GroundInfo {
+  bool grounded{false};
+  Vec2 normal{0.0, 1.0};
+  double distance{0.0};  ///< gap below the skin (0 when resting)
+  int collider{-1};      ///< index into CollisionScene::colliders
+};
+
+struct MoveResult {
+  Vec2 displacement{};   ///< what was actually applied
+  bool hit_wall{false};
+  bool hit_ceiling{false};
+  bool stepped{false};
+};
+
+struct ControllerStats {
+  std::uint64_t broadphase_queries{0};
+  std::uint64_t shape_casts{0};
+  std::uint64_t ground_recomputes{0};
+  std::uint64_t ground_cache_hits{0};
+};
+
+// -----------------------------
+// Character Controller
+// -----------------------------
+class CharacterController {
+public:
+  explicit CharacterController(const CharacterConfig& config = {}, const Vec2& position = {})
+    : config_(config), position_(position), cos_max_slope_(std::cos(config.max_slope)) {}
+
+  [[nodiscard]] const Vec2& position() const noexcept { return position_; }
+  [[nodiscard]] const CharacterConfig& config() const noexcept { return config_; }
+  [[nodiscard]] const ControllerStats& stats() const noexcept { return stats_; }
+
+  /// Place the character without collision (drops the ground cache)
+  void teleport(const Vec2& p) noexcept {
+    position_ = p;
+    cache_valid_ = false;
+  }
+
+  /// Move by displacement, sliding along and stepping over geometry.
+  /// Refreshes the ground cache from the same candidate list.
+  MoveResult move(const CollisionScene& scene, const Vec2& displacement) {
+    MoveResult result;
+    const Vec2 start = position_;
+    const double room = config_.step_height + config_.ground_probe + 2.0 * config_.skin;
+    gather(scene, shape_aabb(start).merged(shape_aabb(start + displacement)).extended(room));
+
+    depenetrate(scene);
+
+    Vec2 remaining = displacement;
+    for (int iter = 0; iter < config_.max_slide_iterations; ++iter) {
+      if (remaining.length_sq() < 1e-18) break;
+      const Hit h = cast(scene, position_, remaining);
+      if (!h.cast.hit) {
+        position_ += remaining;
+        break;
+      }
+      position_ += remaining * h.cast.fraction;
+      const Vec2 rest = remaining * (1.0 - h.cast.fraction);
+      const Vec2 n = h.cast.normal;
+
+      if (n.y < -cos_max_slope_) result.hit_ceiling = true;
+      const bool walkable = n.y >= cos_max_slope_;
+      if (!walkable && n.y > -cos_max_slope_) {
+        result.hit_wall = true;
+        if (!result.stepped && try_step_up(scene, Vec2{rest.x, 0.0})) {
+          result.stepped = true;
+          break;
+        }
+      }
+
+      Vec2 slid = rest - n * rest.dot(n);
+      if (!walkable && slid.y > 0.0) slid.y = 0.0;  // no climbing steep faces
+      remaining = slid;
+    }
+
+    result.displacement = position_ - start;
+    refresh_ground(scene);
+    return result;
+  }
+
+  /// Ground under the character, recomputed only when something that
+  /// could change it has changed
+  const GroundInfo& ground(const CollisionScene& scene) {
+    if (cache_still_valid(scene)) {
+      ++stats_.ground_cache_hits;
+      return ground_;
+    }
+    gather(scene, probe_region(position_));
+    refresh_ground(scene);
+    return ground_;
+  }
+
+private:
+  struct Hit {
+    CastOutput cast{};
+    int collider{-1};
+  };
+
+  [[nodiscard]] Transform2 placed(const Vec2& p) const noexcept { return Transform2{p, Rot2{}}; }
+  [[nodiscard]] AABB shape_aabb(const Vec2& p) const noexcept {
+    return compute_aabb(config_.shape, placed(p));
+  }
+  [[nodiscard]] AABB probe_region(const Vec2& p) const noexcept {
+    AABB box = shape_aabb(p).extended(config_.skin);
+    box.lower.y -= config_.ground_probe + config_.skin;
+    return box;
+  }
+
+  void gather(const CollisionScene& scene, const AABB& region) {
+    ++stats_.broadphase_queries;
+    candidates_.clear();
+    scene.broadphase.query(region, [&](ProxyId id) {
+      candidates_.push_back(static_cast<int>(scene.broadphase.user_data(id)));
+    });
+  }
+
+  /// Earliest hit of the character swept by delta over the candidates
+  [[nodiscard]] Hit cast(const CollisionScene& scene, const Vec2& from, const Vec2& delta) {
+    Hit best;
+    for (const int index : candidates_) {
+      const Collider& c = scene.colliders[index];
+      ++stats_.shape_casts;
+      const CastOutput out = shape_cast(c.shape, c.transform, config_.shape, placed(from),
+                                        delta, config_.skin);
+      if (out.hit && (!best.cast.hit || out.fraction < best.cast.fraction)) {
+        best.cast = out;
+        best.collider = index;
+      }
+    }
+    return best;
+  }
+
+  /// Push out of anything the world moved into us
+  void depenetrate(const CollisionScene& scene) {
+    for (int pass = 0; pass < 4; ++pass) {
+      bool moved = false;
+      for (const int index : candidates_) {
+        const Collider& c = scene.colliders[index];
+        SimplexCache cache;
+        const PenetrationOutput p = epa_penetration(c.shape, c.transform, config_.shape,
+                                                    placed(position_), cache);
+        if (p.separation < config_.skin * 0.5) {
+          position_ += p.normal * (config_.skin - p.separation);
+          moved = true;
+        }
+      }
+      if (!moved) break;
+    }
+  }
+
+  /// Up by step_height, across by forward, then back down onto walkable
+  /// ground. Leaves the character untouched when any stage fails.
+  bool try_step_up(const CollisionScene& scene, const Vec2& forward) {
+    if (config_.step_height <= 0.0 || !ground_.grounded || forward.length_sq() < 1e-18) {
+      return false;
+    }
+    const Vec2 up{0.0, config_.step_height};
+    const Hit h_up = cast(scene, position_, up);
+    const Vec2 raised = position_ + up * h_up.cast.fraction;
+
+    const Hit h_across = cast(scene, raised, forward);
+    const Vec2 across = raised + forward * h_across.cast.fraction;
+    if ((across - raised).length_sq() < 1e-12) return false;
+
+    const Vec2 down{0.0, -(across.y - position_.y) - config_.ground_probe};
+    const Hit h_down = cast(scene, across, down);
+    if (!h_down.cast.hit || h_down.cast.normal.y < cos_max_slope_) return false;
+
+    position_ = across + down * h_down.cast.fraction;
+    return true;
+  }
+
+  void refresh_ground(const CollisionScene& scene) {
+    ++stats_.ground_recomputes;
+    const double probe = config_.ground_probe + config_.skin;
+    const Hit h = cast(scene, position_, Vec2{0.0, -probe});
+    ground_ = GroundInfo{};
+    if (h.cast.hit && h.cast.normal.y >= cos_max_slope_) {
+      ground_.grounded = true;
+      ground_.normal = h.cast.normal;
+      ground_.distance = h.cast.fraction * probe;
+      ground_.collider = h.collider;
+    }
+
+    cache_position_ = position_;
+    cache_stamp_ = scene.broadphase.region_stamp(probe_region(position_));
+    cache_revisions_.clear();
+    for (const int index : candidates_) {
+      cache_revisions_.emplace_back(index, scene.colliders[index].revision);
+    }
+    cache_valid_ = true;
+  }
+
+  [[nodiscard]] bool cache_still_valid(const CollisionScene& scene) const {
+    if (!cache_valid_) return false;
+    if ((position_ - cache_position_).length_sq() > config_.cache_tolerance * config_.cache_tolerance) {
+      return false;
+    }
+    // Stamp catches colliders entering/leaving; revisions catch colliders
+    // that moved inside their fat boxes
+    if (scene.broadphase.region_stamp(probe_region(position_)) != cache_stamp_) return false;
+    for (const auto& [index, revision] : cache_revisions_) {
+      if (static_cast<std::size_t>(index) >= scene.colliders.size() ||
+          scene.colliders[index].revision != revision) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  CharacterConfig config_;
+  Vec2 position_;
+  double cos_max_slope_;
+
+  std::vector<int> candidates_;
+  GroundInfo ground_{};
+  bool cache_valid_{false};
+  Vec2 cache_position_{};
+  std::uint64_t cache_stamp_{0};
+  std::vector<std::pair<int, std::uint32_t>> cache_revisions_;
+  ControllerStats stats_{};
+};
+
+} // namespace sim
+
+#endif // SIM_CHARACTER_CONTROLLER_HPP
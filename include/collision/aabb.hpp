@@ -0,0 +1,68 @@
+#pragma once
+#ifndef SIM_AABB_HPP
+#define SIM_AABB_HPP
+// include/collision/aabb.hpp
+// Axis-aligned bounding box
+
+#include "gjk.hpp"  // ConvexProxy
+#include "../math/transform2.hpp"
+#include <algorithm>  // std::min, std::max
+
+namespace sim {
+
+// -----------------------------
+// Axis-Aligned Bounding Box
+// -----------------------------
+struct AABB {
+  Vec2 lower{};
+  Vec2 upper{};
+
+  [[nodiscard]] constexpr bool overlaps(const AABB& o) const noexcept {
+    return lower.x <= o.upper.x && o.lower.x <= upper.x &&
+           lower.y <= o.upper.y && o.lower.y <= upper.y;
+  }
+
+  [[nodiscard]] constexpr bool contains(const AABB& o) const noexcept {
+    return lower.x <= o.lower.x && lower.y <= o.lower.y &&
+           o.upper.x <= upper.x && o.upper.y <= upper.y;
+  }
+
+  [[nodiscard]] constexpr bool contains(const Vec2& p) const noexcept {
+    return lower.x <= p.x && p.x <= upper.x && lower.y <= p.y && p.y <= upper.y;
+  }
+
+  /// Smallest box containing both
+  [[nodiscard]] constexpr AABB merged(const AABB& o) const noexcept {
+    return AABB{Vec2{std::min(lower.x, o.lower.x), std::min(lower.y, o.lower.y)},
+                Vec2{std::max(upper.x, o.upper.x), std::max(upper.y, o.upper.y)}};
+  }
+
+  /// Grown by margin on every side
+  [[nodiscard]] constexpr AABB extended(double margin) const noexcept {
+    return AABB{lower - Vec2{margin, margin}, upper + Vec2{margin, margin}};
+  }
+
+  /// Translated by d
+  [[nodiscard]] constexpr AABB shifted(const Vec2& d) const noexcept {
+    return AABB{lower + d, upper + d};
+  }
+
+  [[nodiscard]] constexpr Vec2 center() const noexcept { return (lower + upper) * 0.5; }
+  [[nodiscard]] constexpr Vec2 extents() const noexcept { return (upper - lower) * 0.5; }
+};
+
+/// Bounds of a convex proxy placed by xf (includes the radius)
+[[nodiscard]] constexpr AABB compute_aabb(const ConvexProxy& shape, const Transform2& xf) noexcept {
+  Vec2 lo = xf.apply(shape.vertices[0]);
+  Vec2 hi = lo;
+  for (int i = 1; i < shape.count; ++i) {
+    const Vec2 v = xf.apply(shape.vertices[i]);
+    lo = Vec2{std::min(lo.x, v.x), std::min(lo.y, v.y)};
+    hi = Vec2{std::max(hi.x, v.x), std::max(hi.y, v.y)};
+  }
+  return AABB{lo, hi}.extended(shape.radius);
+}
+
+} // namespace sim
+
+#endif // SIM_AABB_HPP
@@ -0,0 +1,306 @@
+#pragma once
+#ifndef SIM_BROADPHASE_HPP
+#define SIM_BROADPHASE_HPP
+// include/collision/broadphase.hpp
+// Uniform-grid broadphase with fat AABBs and incremental pair updates
+//
+// Design notes:
+//  - Proxies store a fat AABB (tight box + margin). Small motions stay
+//    inside it and cost nothing; only escaping proxies are re-inserted
+//    and put in the move buffer
+//  - update_pairs() only re-examines pairs that involve moved proxies
+//    and reports which pairs began and ended this update
+//  - Queries are stateless: a proxy spanning several cells is reported
+//    only from the first cell shared with the query box, so no per-query
+//    visit marks are needed and const queries are safe to run in parallel
+//  - Every cell carries a modification stamp so callers can cheaply
+//    detect whether anything entered or left a region
+//  - Collision filters are checked before a pair is emitted; rejected
+//    pairs are counted but never stored
+
+#include "aabb.hpp"
+#include "filter.hpp"
+#include <algorithm>  // std::max, std::min, std::find
+#include <cmath>      // std::floor
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace sim {
+
+using ProxyId = std::int32_t;
+inline constexpr ProxyId kNullProxy = -1;
+
+struct BroadphasePair {
+  ProxyId a{kNullProxy};   ///< always the smaller id
+  ProxyId b{kNullProxy};
+
+  [[nodiscard]] constexpr bool operator==(const BroadphasePair&) const noexcept = default;
+};
+
+/// Pairs that started or stopped overlapping in the last update_pairs()
+struct PairChanges {
+  std::vector<BroadphasePair> begun;
+  std::vector<BroadphasePair> ended;
+};
+
+// -----------------------------
+// Broadphase
+// -----------------------------
+class Broadphase {
+public:
+  explicit Broadphase(double cell_size = 2.0, double margin = 0.1)
+    : cell_size_(cell_size), inv_cell_size_(1.0 / cell_size), margin_(margin) {}
+
+  /// Insert a proxy for a tight AABB; user_data is returned by queries
+  ProxyId create_proxy(const AABB& aabb, std::uint32_t user_data,
+                       const CollisionFilter& filter = {}) {
+    ProxyId id;
+    if (!free_.empty()) {
+      id = free_.back();
+      free_.pop_back();
+    } else {
+      id = static_cast<ProxyId>(proxies_.size());
+      proxies_.emplace_back();
+    }
+    Proxy& p = proxies_[id];
+    p.fat = aabb.extended(margin_);
+    p.user_data = user_data;
+    p.filter = filter;
+    p.alive = true;
+    p.moved = false;
+    insert_cells(id);
+    mark_moved(id);
+    return id;
+  }
+
+  void destroy_proxy(ProxyId id) {
+    remove_cells(id);
+    proxies_[id].alive = false;
+    mark_moved(id);
+    // Recycled only after the next update so stale pairs end cleanly
+    pending_free_.push_back(id);
+  }
+
+  /// Update a proxy's tight AABB. Returns true when it left its fat box
+  /// and was re-inserted (and will be re-paired on the next update).
+  bool move_proxy(ProxyId id, const AABB& aabb) {
+    Proxy& p = proxies_[id];
+    if (p.fat.contains(aabb)) return false;
+    remove_cells(id);
+    p.fat = aabb.extended(margin_);
+    insert_cells(id);
+    mark_moved(id);
+    return true;
+  }
+
+  /// Change a proxy's filter; its pairs are re-evaluated on the next update
+  void set_filter(ProxyId id, const CollisionFilter& filter) {
+    if (proxies_[id].filter == filter) return;
+    proxies_[id].filter = filter;
+    mark_moved(id);
+  }
+
+  [[nodiscard]] const AABB& fat_aabb(ProxyId id) const noexcept { return proxies_[id].fat; }
+  [[nodiscard]] std::uint32_t user_data(ProxyId id) const noexcept { return proxies_[id].user_data; }
+  [[nodiscard]] const CollisionFilter& filter(ProxyId id) const noexcept { return proxies_[id].filter; }
+  [[nodiscard]] std::size_t proxy_count() const noexcept {
+    return proxies_.size() - free_.size() - pending_free_.size();
+  }
+  [[nodiscard]] double cell_size() const noexcept { return cell_size_; }
+
+  /// Call fn(ProxyId) for each proxy whose fat AABB overlaps box.
+  /// fn may return false to stop early.
+  template<typename Fn>
+  void query(const AABB& box, Fn&& fn) const {
+    const CellRange r = cell_range(box);
+    for (int iy = r.y0; iy <= r.y1; ++iy) {
+      for (int ix = r.x0; ix <= r.x1; ++ix) {
+        const auto it = cells_.find(cell_key(ix, iy));
+        if (it == cells_.end()) continue;
+        for (const ProxyId id : it->second.proxies) {
+          const Proxy& p = proxies_[id];
+          if (!p.fat.overlaps(box)) continue;
+          // Report once: from the first cell shared by both ranges
+          const CellRange pr = cell_range(p.fat);
+          if (ix != std::max(r.x0, pr.x0) || iy != std::max(r.y0, pr.y0)) continue;
+          if (!report(fn, id)) return;
+        }
+      }
+    }
+  }
+
+  /// Largest modification stamp of the cells covering box. Changes
+  /// whenever a proxy is inserted into or removed from those cells.
+  [[nodiscard]] std::uint64_t region_stamp(const AABB& box) const {
+    const CellRange r = cell_range(box);
+    std::uint64_t stamp = 0;
+    for (int iy = r.y0; iy <= r.y1; ++iy) {
+      for (int ix = r.x0; ix <= r.x1; ++ix) {
+        const auto it = cells_.find(cell_key(ix, iy));
+        if (it != cells_.end()) stamp = std::max(stamp, it->second.stamp);
+      }
+    }
+    return stamp;
+  }
+
+  /// Re-pair moved proxies. Persistent pairs among unmoved proxies are
+  /// not touched; changes() reports what began and ended.
+  void update_pairs() {
+    changes_.begun.clear();
+    changes_.ended.clear();
+    filtered_ = 0;
+
+    // Ended: pairs with a moved member that no longer overlap or pass the filter
+    std::size_t keep = 0;
+    for (std::size_t i = 0; i < pairs_.size(); ++i) {
+      const BroadphasePair pair = pairs_[i];
+      const Proxy& pa = proxies_[pair.a];
+      const Proxy& pb = proxies_[pair.b];
+      const bool dirty = pa.moved || pb.moved;
+      if (dirty && (!pa.alive || !pb.alive || !pa.fat.overlaps(pb.fat) ||
+                    !should_collide(pa.filter, pb.filter))) {
+        pair_set_.erase(pair_key(pair));
+        changes_.ended.push_back(pair);
+        continue;
+      }
+      pairs_[keep++] = pair;
+    }
+    pairs_.resize(keep);
+
+    // Begun: query around each moved proxy
+    for (const ProxyId m : move_buffer_) {
+      if (!proxies_[m].alive) continue;
+      query(proxies_[m].fat, [&](ProxyId other) {
+        if (other == m) return true;
+        // Both moved: let the smaller id's query own the pair
+        if (proxies_[other].moved && other < m) return true;
+        if (!should_collide(proxies_[m].filter, proxies_[other].filter)) {
+          ++filtered_;
+          return true;
+        }
+        const BroadphasePair pair{std::min(m, other), std::max(m, other)};
+        if (pair_set_.insert(pair_key(pair)).second) {
+          pairs_.push_back(pair);
+          changes_.begun.push_back(pair);
+        }
+        return true;
+      });
+    }
+
+    for (const ProxyId m : move_buffer_) proxies_[m].moved = false;
+    move_buffer_.clear();
+    free_.insert(free_.end(), pending_free_.begin(), pending_free_.end());
+    pending_free_.clear();
+  }
+
+  /// All currently overlapping pairs
+  [[nodiscard]] std::span<const BroadphasePair> pairs() const noexcept { return pairs_; }
+  [[nodiscard]] const PairChanges& changes() const noexcept { return changes_; }
+  /// Candidate pairs rejected by filters during the last update_pairs()
+  [[nodiscard]] std::size_t filtered_count() const noexcept { return filtered_; }
+
+private:
+  struct Proxy {
+    AABB fat{};
+    std::uint32_t user_data{0};
+    CollisionFilter filter{};
+    bool alive{false};
+    bool moved{false};
+  };
+
+  struct Cell {
+    std::vector<ProxyId> proxies;
+    std::uint64_t stamp{0};
+  };
+
+  struct CellRange {
+    int x0, y0, x1, y1;
+  };
+
+  template<typename Fn>
+  static bool report(Fn& fn, ProxyId id) {
+    if constexpr (std::is_same_v<decltype(fn(id)), bool>) {
+      return fn(id);
+    } else {
+      fn(id);
+      return true;
+    }
+  }
+
+  [[nodiscard]] static constexpr std::uint64_t cell_key(int ix, int iy) noexcept {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ix)) << 32) |
+           static_cast<std::uint32_t>(iy);
+  }
+
+  [[nodiscard]] static constexpr std::uint64_t pair_key(const BroadphasePair& p) noexcept {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(p.a)) << 32) |
+           static_cast<std::uint32_t>(p.b);
+  }
+
+  [[nodiscard]] CellRange cell_range(const AABB& box) const noexcept {
+    return CellRange{static_cast<int>(std::floor(box.lower.x * inv_cell_size_)),
+                     static_cast<int>(std::floor(box.lower.y * inv_cell_size_)),
+                     static_cast<int>(std::floor(box.upper.x * inv_cell_size_)),
+                     static_cast<int>(std::floor(box.upper.y * inv_cell_size_))};
+  }
+
+  void insert_cells(ProxyId id) {
+    const CellRange r = cell_range(proxies_[id].fat);
+    ++modification_;
+    for (int iy = r.y0; iy <= r.y1; ++iy) {
+      for (int ix = r.x0; ix <= r.x1; ++ix) {
+        Cell& c = cells_[cell_key(ix, iy)];
+        c.proxies.push_back(id);
+        c.stamp = modification_;
+      }
+    }
+  }
+
+  void remove_cells(ProxyId id) {
+    const CellRange r = cell_range(proxies_[id].fat);
+    ++modification_;
+    for (int iy = r.y0; iy <= r.y1; ++iy) {
+      for (int ix = r.x0; ix <= r.x1; ++ix) {
+        // Empty cells are kept so their stamp survives
+        Cell& c = cells_[cell_key(ix, iy)];
+        const auto it = std::find(c.proxies.begin(), c.proxies.end(), id);
+        if (it != c.proxies.end()) {
+          *it = c.proxies.back();
+          c.proxies.pop_back();
+        }
+        c.stamp = modification_;
+      }
+    }
+  }
+
+  void mark_moved(ProxyId id) {
+    if (!proxies_[id].moved) {
+      proxies_[id].moved = true;
+      move_buffer_.push_back(id);
+    }
+  }
+
+  double cell_size_;
+  double inv_cell_size_;
+  double margin_;
+
+  std::vector<Proxy> proxies_;
+  std::vector<ProxyId> free_;
+  std::vector<ProxyId> pending_free_;
+  std::vector<ProxyId> move_buffer_;
+  std::unordered_map<std::uint64_t, Cell> cells_;
+  std::uint64_t modification_{0};
+
+  std::vector<BroadphasePair> pairs_;
+  std::unordered_set<std::uint64_t> pair_set_;
+  PairChanges changes_;
+  std::size_t filtered_{0};
+};
+
+} // namespace sim
+
+#endif // SIM_BROADPHASE_HPP
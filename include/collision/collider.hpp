@@ -0,0 +1,67 @@
+#pragma once
+#ifndef SIM_COLLIDER_HPP
+#define SIM_COLLIDER_HPP
+// include/collision/collider.hpp
+// Placed collision shape and the read-only scene view used by queries
+//
+// Design notes:
+//  - Colliders live in a caller-owned array; the broadphase user_data
+//    of each proxy is the collider's index in that array
+//  - revision must be bumped whenever the shape or transform changes,
+//    which lets query caches tell "still valid" from "geometry moved"
+
+#include "aabb.hpp"
+#include "broadphase.hpp"
+#include "gjk.hpp"
+#include "../dynamics/material.hpp"
+#include <cstdint>
+#include <span>
+
+namespace sim {
+
+// -----------------------------
+// Collider
+// -----------------------------
+struct Collider {
+  ConvexProxy shape{};
+  Transform2 transform{};
+  ProxyId proxy{kNullProxy};
+  std::uint32_t revision{0};
+  CollisionFilter filter{};
+  MaterialId material{kDefaultMaterial};
+  bool is_sensor{false};   ///< reports overlaps (see SensorSystem), never generates contacts
+
+  [[nodiscard]] AABB aabb() const noexcept { return compute_aabb(shape, transform); }
+
+  /// Move the collider and keep its broadphase proxy in sync
+  void set_transform(const Transform2& xf, Broadphase& broadphase) {
+    transform = xf;
+    ++revision;
+    if (proxy != kNullProxy) broadphase.move_proxy(proxy, aabb());
+  }
+
+  void set_filter(const CollisionFilter& f, Broadphase& broadphase) {
+    filter = f;
+    if (proxy != kNullProxy) broadphase.set_filter(proxy, f);
+  }
+};
+
+/// Register colliders[index] with the broadphase
+inline void attach_collider(std::span<Collider> colliders, std::uint32_t index,
+                            Broadphase& broadphase) {
+  Collider& c = colliders[index];
+  c.proxy = broadphase.create_proxy(c.aabb(), index, c.filter);
+}
+
+// -----------------------------
+// Collision Scene
+// -----------------------------
+/// Non-owning view of the geometry a query runs against
+struct CollisionScene {
+  const Broadphase& broadphase;
+  std::span<const Collider> colliders;
+};
+
+} // namespace sim
+
+#endif // SIM_COLLIDER_HPP
@@ -0,0 +1,33 @@
+#pragma once
+#ifndef SIM_FILTER_HPP
+#define SIM_FILTER_HPP
+// include/collision/filter.hpp
+// Category/mask/group collision filter
+//
+// Design notes:
+//  - Same rules as Box2D: a shared non-zero group overrides the masks
+//    (positive = always collide, negative = never), otherwise both
+//    category/mask tests must pass
+//  - Evaluated by the broadphase when pairs are emitted, so a filtered
+//    pair never reaches the narrowphase, contacts or sensors
+
+#include <cstdint>
+
+namespace sim {
+
+struct CollisionFilter {
+  std::uint32_t category{0x0001};      ///< bits this shape belongs to
+  std::uint32_t mask{0xFFFF'FFFF};     ///< categories this shape collides with
+  std::int32_t group{0};               ///< shared non-zero group overrides the masks
+
+  [[nodiscard]] constexpr bool operator==(const CollisionFilter&) const noexcept = default;
+};
+
+[[nodiscard]] constexpr bool should_collide(const CollisionFilter& a, const CollisionFilter& b) noexcept {
+  if (a.group == b.group && a.group != 0) return a.group > 0;
+  return (a.category & b.mask) != 0 && (b.category & a.mask) != 0;
+}
+
+} // namespace sim
+
+#endif // SIM_FILTER_HPP
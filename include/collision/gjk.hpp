@@ -0,0 +1,568 @@
+#pragma once
+#ifndef SIM_GJK_HPP
+#define SIM_GJK_HPP
+// include/collision/gjk.hpp
+// GJK distance and EPA penetration for general convex shapes
+//
+// Design notes:
+//  - Shapes are point clouds with a radius (ConvexProxy): a circle is
+//    one point, a capsule two, a rounded polygon N. GJK runs on the
+//    core points and the radii are applied afterwards
+//  - SimplexCache stores the final simplex per pair. Feeding it back
+//    next step warm-starts GJK; for resting contacts the cached simplex
+//    is already optimal and the loop ends after one support query
+//  - EPA only runs when the cores overlap, which for rounded shapes is
+//    the deep-penetration fallback rather than the common path
+
+#include "polygon.hpp"
+#include "../math/transform2.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>    // std::swap
+
+namespace sim {
+
+// -----------------------------
+// Convex Proxy
+// -----------------------------
+struct ConvexProxy {
+  std::array<Vec2, kMaxPolygonVertices> vertices{};
+  int count{0};
+  double radius{0.0};
+
+  /// Index of the vertex furthest along local direction d
+  [[nodiscard]] constexpr int support(const Vec2& d) const noexcept {
+    int best = 0;
+    double best_dot = vertices[0].dot(d);
+    for (int i = 1; i < count; ++i) {
+      const double v = vertices[i].dot(d);
+      if (v > best_dot) {
+        best_dot = v;
+        best = i;
+      }
+    }
+    return best;
+  }
+};
+
+/// Proxy for a polygon, optionally rounded by radius
+[[nodiscard]] constexpr ConvexProxy make_proxy(const Polygon& poly, double radius = 0.0) noexcept {
+  ConvexProxy p;
+  p.vertices = poly.vertices;
+  p.count = poly.count;
+  p.radius = radius;
+  return p;
+}
+
+/// Capsule: segment p1-p2 swept by radius
+[[nodiscard]] constexpr ConvexProxy make_capsule(const Vec2& p1, const Vec2& p2,
+                                                 double radius) noexcept {
+  ConvexProxy p;
+  p.vertices[0] = p1;
+  p.vertices[1] = p2;
+  p.count = 2;
+  p.radius = radius;
+  return p;
+}
+
+/// Circle of the given radius around center
+[[nodiscard]] constexpr ConvexProxy make_circle(const Vec2& center, double radius) noexcept {
+  ConvexProxy p;
+  p.vertices[0] = center;
+  p.count = 1;
+  p.radius = radius;
+  return p;
+}
+
+// -----------------------------
+// Simplex Cache
+// -----------------------------
+/// Warm-start data for GJK. Zero-initialise for a new pair and keep it
+/// alongside the pair between steps.
+struct SimplexCache {
+  double metric{0.0};            ///< length or area of the cached simplex
+  std::uint16_t count{0};
+  std::uint8_t index_a[3]{};
+  std::uint8_t index_b[3]{};
+};
+
+// -----------------------------
+// Query Results
+// -----------------------------
+struct DistanceOutput {
+  Vec2 point_a{};       ///< closest point on A (world)
+  Vec2 point_b{};       ///< closest point on B (world)
+  Vec2 normal{};        ///< unit direction from A to B, zero if overlapping
+  double distance{0.0};
+  int iterations{0};    ///< support queries performed
+  int simplex_count{0}; ///< 3 means the cores overlap
+};
+
+struct PenetrationOutput {
+  Vec2 point_a{};       ///< deepest point of A inside B (world)
+  Vec2 point_b{};       ///< deepest point of B inside A (world)
+  Vec2 normal{};        ///< unit direction from A to B
+  double separation{0.0}; ///< signed: negative when penetrating
+  int iterations{0};
+};
+
+namespace detail {
+
+inline constexpr double kGjkEpsilon = 1e-12;
+inline constexpr int kGjkMaxIterations = 20;
+
+struct SimplexVertex {
+  Vec2 wa{};      ///< support point on A
+  Vec2 wb{};      ///< support point on B
+  Vec2 w{};       ///< wb - wa
+  double a{0.0};  ///< barycentric coordinate of the closest point
+  int index_a{0};
+  int index_b{0};
+};
+
+struct Simplex {
+  std::array<SimplexVertex, 3> v{};
+  int count{0};
+
+  [[nodiscard]] double metric() const noexcept {
+    switch (count) {
+      case 2: return v[0].w.distance_to(v[1].w);
+      case 3: return (v[1].w - v[0].w).cross(v[2].w - v[0].w);
+      default: return 0.0;
+    }
+  }
+
+  [[nodiscard]] constexpr Vec2 search_direction() const noexcept {
+    if (count == 1) return -v[0].w;
+    const Vec2 e12 = v[1].w - v[0].w;
+    // Origin on the left of e12 -> search left, otherwise right
+    return e12.cross(-v[0].w) > 0.0 ? e12.perpendicular() : -e12.perpendicular();
+  }
+
+  constexpr void witness_points(Vec2& pa, Vec2& pb) const noexcept {
+    switch (count) {
+      case 1:
+        pa = v[0].wa;
+        pb = v[0].wb;
+        break;
+      case 2:
+        pa = v[0].wa * v[0].a + v[1].wa * v[1].a;
+        pb = v[0].wb * v[0].a + v[1].wb * v[1].a;
+        break;
+      default:
+        pa = v[0].wa * v[0].a + v[1].wa * v[1].a + v[2].wa * v[2].a;
+        pb = pa;
+        break;
+    }
+  }
+
+  /// Closest point to the origin on segment w1-w2
+  constexpr void solve2() noexcept {
+    const Vec2 w1 = v[0].w;
+    const Vec2 w2 = v[1].w;
+    const Vec2 e12 = w2 - w1;
+
+    const double d12_2 = -w1.dot(e12);
+    if (d12_2 <= 0.0) {
+      v[0].a = 1.0;
+      count = 1;
+      return;
+    }
+    const double d12_1 = w2.dot(e12);
+    if (d12_1 <= 0.0) {
+      v[1].a = 1.0;
+      v[0] = v[1];
+      count = 1;
+      return;
+    }
+    const double inv = 1.0 / (d12_1 + d12_2);
+    v[0].a = d12_1 * inv;
+    v[1].a = d12_2 * inv;
+    count = 2;
+  }
+
+  /// Closest point to the origin on triangle w1-w2-w3 (Voronoi regions)
+  constexpr void solve3() noexcept {
+    const Vec2 w1 = v[0].w;
+    const Vec2 w2 = v[1].w;
+    const Vec2 w3 = v[2].w;
+
+    const Vec2 e12 = w2 - w1;
+    const double d12_1 = w2.dot(e12);
+    const double d12_2 = -w1.dot(e12);
+
+    const Vec2 e13 = w3 - w1;
+    const double d13_1 = w3.dot(e13);
+    const double d13_2 = -w1.dot(e13);
+
+    const Vec2 e23 = w3 - w2;
+    const double d23_1 = w3.dot(e23);
+    const double d23_2 = -w2.dot(e23);
+
+    const double n123 = e12.cross(e13);
+    const double d123_1 = n123 * w2.cross(w3);
+    const double d123_2 = n123 * w3.cross(w1);
+    const double d123_3 = n123 * w1.cross(w2);
+
+    if (d12_2 <= 0.0 && d13_2 <= 0.0) {
+      v[0].a = 1.0;
+      count = 1;
+      return;
+    }
+    if (d12_1 > 0.0 && d12_2 > 0.0 && d123_3 <= 0.0) {
+      const double inv = 1.0 / (d12_1 + d12_2);
+      v[0].a = d12_1 * inv;
+      v[1].a = d12_2 * inv;
+      count = 2;
+      return;
+    }
+    if (d13_1 > 0.0 && d13_2 > 0.0 && d123_2 <= 0.0) {
+      const double inv = 1.0 / (d13_1 + d13_2);
+      v[0].a = d13_1 * inv;
+      v[2].a = d13_2 * inv;
+      v[1] = v[2];
+      count = 2;
+      return;
+    }
+    if (d12_1 <= 0.0 && d23_2 <= 0.0) {
+      v[1].a = 1.0;
+      v[0] = v[1];
+      count = 1;
+      return;
+    }
+    if (d13_1 <= 0.0 && d23_1 <= 0.0) {
+      v[2].a = 1.0;
+      v[0] = v[2];
+      count = 1;
+      return;
+    }
+    if (d23_1 > 0.0 && d23_2 > 0.0 && d123_1 <= 0.0) {
+      const double inv = 1.0 / (d23_1 + d23_2);
+      v[1].a = d23_1 * inv;
+      v[2].a = d23_2 * inv;
+      v[0] = v[2];
+      count = 2;
+      return;
+    }
+    const double inv = 1.0 / (d123_1 + d123_2 + d123_3);
+    v[0].a = d123_1 * inv;
+    v[1].a = d123_2 * inv;
+    v[2].a = d123_3 * inv;
+    count = 3;
+  }
+};
+
+/// Support point of the Minkowski difference B - A along world direction d
+[[nodiscard]] constexpr SimplexVertex support_vertex(const ConvexProxy& a, const Transform2& xfa,
+                                                     const ConvexProxy& b, const Transform2& xfb,
+                                                     const Vec2& d) noexcept {
+  SimplexVertex sv;
+  sv.index_a = a.support(xfa.q.inv_apply(-d));
+  sv.index_b = b.support(xfb.q.inv_apply(d));
+  sv.wa = xfa.apply(a.vertices[sv.index_a]);
+  sv.wb = xfb.apply(b.vertices[sv.index_b]);
+  sv.w = sv.wb - sv.wa;
+  return sv;
+}
+
+/// Rebuild the simplex from the cache, or seed it with vertex 0/0
+inline Simplex read_cache(const SimplexCache& cache,
+                          const ConvexProxy& a, const Transform2& xfa,
+                          const ConvexProxy& b, const Transform2& xfb) noexcept {
+  Simplex s;
+  s.count = cache.count;
+  for (int i = 0; i < s.count; ++i) {
+    SimplexVertex& sv = s.v[i];
+    sv.index_a = cache.index_a[i] < a.count ? cache.index_a[i] : 0;
+    sv.index_b = cache.index_b[i] < b.count ? cache.index_b[i] : 0;
+    sv.wa = xfa.apply(a.vertices[sv.index_a]);
+    sv.wb = xfb.apply(b.vertices[sv.index_b]);
+    sv.w = sv.wb - sv.wa;
+    sv.a = -1.0;
+  }
+
+  // Discard the cache if the simplex changed shape a lot since last step.
+  // A triangle's metric is a signed area: either winding is a valid cache
+  if (s.count > 1) {
+    const double m1 = std::abs(cache.metric);
+    const double m2 = std::abs(s.metric());
+    if (m2 < 0.5 * m1 || 2.0 * m1 < m2 || m2 < kGjkEpsilon) s.count = 0;
+  }
+
+  if (s.count == 0) {
+    SimplexVertex& sv = s.v[0];
+    sv.index_a = 0;
+    sv.index_b = 0;
+    sv.wa = xfa.apply(a.vertices[0]);
+    sv.wb = xfb.apply(b.vertices[0]);
+    sv.w = sv.wb - sv.wa;
+    sv.a = 1.0;
+    s.count = 1;
+  }
+  return s;
+}
+
+inline void write_cache(const Simplex& s, SimplexCache& cache) noexcept {
+  cache.metric = s.metric();
+  cache.count = static_cast<std::uint16_t>(s.count);
+  for (int i = 0; i < s.count; ++i) {
+    cache.index_a[i] = static_cast<std::uint8_t>(s.v[i].index_a);
+    cache.index_b[i] = static_cast<std::uint8_t>(s.v[i].index_b);
+  }
+}
+
+/// Core GJK loop; leaves the final simplex in s
+inline int run_gjk(Simplex& s, const ConvexProxy& a, const Transform2& xfa,
+                   const ConvexProxy& b, const Transform2& xfb) noexcept {
+  int iterations = 0;
+  while (iterations < kGjkMaxIterations) {
+    int save_a[3];
+    int save_b[3];
+    const int save_count = s.count;
+    for (int i = 0; i < save_count; ++i) {
+      save_a[i] = s.v[i].index_a;
+      save_b[i] = s.v[i].index_b;
+    }
+
+    if (s.count == 2) s.solve2();
+    else if (s.count == 3) s.solve3();
+
+    if (s.count == 3) break;  // origin enclosed: cores overlap
+
+    const Vec2 d = s.search_direction();
+    if (d.length_sq() < kGjkEpsilon * kGjkEpsilon) break;  // origin on the simplex
+
+    s.v[s.count] = support_vertex(a, xfa, b, xfb, d);
+    ++iterations;
+
+    // A repeated support vertex means no further progress is possible
+    bool duplicate = false;
+    for (int i = 0; i < save_count; ++i) {
+      if (s.v[s.count].index_a == save_a[i] && s.v[s.count].index_b == save_b[i]) {
+        duplicate = true;
+        break;
+      }
+    }
+    if (duplicate) break;
+
+    ++s.count;
+  }
+  return iterations;
+}
+
+/// Warm-started GJK between the cores (no radii); leaves the final
+/// simplex in s and updates the cache
+inline DistanceOutput core_distance(const ConvexProxy& a, const Transform2& xfa,
+                                    const ConvexProxy& b, const Transform2& xfb,
+                                    SimplexCache& cache, Simplex& s) noexcept {
+  DistanceOutput out;
+  s = read_cache(cache, a, xfa, b, xfb);
+  out.iterations = run_gjk(s, a, xfa, b, xfb);
+
+  s.witness_points(out.point_a, out.point_b);
+  out.distance = out.point_a.distance_to(out.point_b);
+  out.simplex_count = s.count;
+  write_cache(s, cache);
+
+  if (out.distance > kGjkEpsilon) {
+    out.normal = (out.point_b - out.point_a) / out.distance;
+  }
+  return out;
+}
+
+/// Convex hull of pts[0, n), n <= 8, in place and counter-clockwise
+/// (monotone chain).
+/// Returns the hull size; below 3 the points are collinear.
+inline int convex_hull(SimplexVertex* pts, int n) noexcept {
+  // Insertion sort by (x, y): n is a handful of points
+  for (int i = 1; i < n; ++i) {
+    const SimplexVertex key = pts[i];
+    int j = i - 1;
+    while (j >= 0 && (pts[j].w.x > key.w.x || (pts[j].w.x == key.w.x && pts[j].w.y > key.w.y))) {
+      pts[j + 1] = pts[j];
+      --j;
+    }
+    pts[j + 1] = key;
+  }
+  if (n < 3) return n;
+
+  SimplexVertex hull[2 * 8];
+  int h = 0;
+  const auto turns_left = [&](const SimplexVertex& p) {
+    return (hull[h - 1].w - hull[h - 2].w).cross(p.w - hull[h - 2].w) > 0.0;
+  };
+  for (int i = 0; i < n; ++i) {                 // lower chain
+    while (h >= 2 && !turns_left(pts[i])) --h;
+    hull[h++] = pts[i];
+  }
+  for (int i = n - 2, lower = h + 1; i >= 0; --i) {  // upper chain
+    while (h >= lower && !turns_left(pts[i])) --h;
+    hull[h++] = pts[i];
+  }
+  --h;  // last point repeats the first
+  for (int i = 0; i < h; ++i) pts[i] = hull[i];
+  return h;
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────────────────────
+
+/// Closest points between two convex proxies. With use_radii the
+/// result is measured between the rounded surfaces; overlapping shapes
+/// report distance 0 (use epa_penetration for depth).
+[[nodiscard]] inline DistanceOutput gjk_distance(const ConvexProxy& a, const Transform2& xfa,
+                                                 const ConvexProxy& b, const Transform2& xfb,
+                                                 SimplexCache& cache,
+                                                 bool use_radii = true) noexcept {
+  detail::Simplex s;
+  DistanceOutput out = detail::core_distance(a, xfa, b, xfb, cache, s);
+
+  if (use_radii) {
+    const double ra = a.radius;
+    const double rb = b.radius;
+    if (out.distance > ra + rb && out.distance > detail::kGjkEpsilon) {
+      out.distance -= ra + rb;
+      out.point_a += out.normal * ra;
+      out.point_b -= out.normal * rb;
+    } else {
+      const Vec2 p = out.point_a.lerp(out.point_b, 0.5);
+      out.point_a = p;
+      out.point_b = p;
+      out.distance = 0.0;
+    }
+  }
+  return out;
+}
+
+/// Signed separation between two convex proxies including radii.
+/// Uses GJK when the cores are disjoint and EPA when they overlap.
+[[nodiscard]] inline PenetrationOutput epa_penetration(const ConvexProxy& a, const Transform2& xfa,
+                                                       const ConvexProxy& b, const Transform2& xfb,
+                                                       SimplexCache& cache) noexcept {
+  PenetrationOutput out;
+  const double radii = a.radius + b.radius;
+
+  detail::Simplex s;
+  const DistanceOutput core = detail::core_distance(a, xfa, b, xfb, cache, s);
+  out.iterations = core.iterations;
+  if (core.distance > 1e-9) {
+    out.normal = core.normal;
+    out.separation = core.distance - radii;
+    out.point_a = core.point_a + core.normal * a.radius;
+    out.point_b = core.point_b - core.normal * b.radius;
+    return out;
+  }
+
+  // Cores overlap: expand a CCW polytope of B - A towards its boundary,
+  // starting from the simplex GJK ended on. It encloses the origin, but a
+  // warm-started vertex need not lie on the boundary, so the polytope is
+  // kept convex as fresh support points are added
+  constexpr int k_max_vertices = 32;
+  std::array<detail::SimplexVertex, k_max_vertices> poly{};
+  int n = 0;
+  for (int i = 0; i < s.count; ++i) poly[n++] = s.v[i];
+
+  if (n == 3) {
+    if ((poly[1].w - poly[0].w).cross(poly[2].w - poly[0].w) < 0.0) std::swap(poly[1], poly[2]);
+  } else {
+    // Origin on a vertex or edge of the simplex (touching cores): widen
+    // it with supports across the edge, or along the axes for a point
+    const Vec2 e = n == 2 ? poly[1].w - poly[0].w : Vec2{1.0, 0.0};
+    poly[n++] = detail::support_vertex(a, xfa, b, xfb, e.perpendicular());
+    poly[n++] = detail::support_vertex(a, xfa, b, xfb, -e.perpendicular());
+    if (n == 3) {
+      poly[n++] = detail::support_vertex(a, xfa, b, xfb, e);
+      poly[n++] = detail::support_vertex(a, xfa, b, xfb, -e);
+    }
+  }
+  if (n > 3 || (poly[1].w - poly[0].w).cross(poly[2].w - poly[0].w) <= 0.0) {
+    n = detail::convex_hull(poly.data(), n);
+  }
+
+  Vec2 best_normal{};
+  double best_dist = 0.0;
+  int best_edge = -1;
+
+  if (n >= 3) {
+    for (int iter = 0; iter < k_max_vertices; ++iter) {
+      best_edge = -1;
+      best_dist = 0.0;
+      for (int i = 0; i < n; ++i) {
+        const Vec2 e = poly[(i + 1) % n].w - poly[i].w;
+        const double len = e.length();
+        if (len < detail::kGjkEpsilon) continue;  // degenerate edge
+        const Vec2 normal = -e.perpendicular() / len;
+        const double dist = normal.dot(poly[i].w);
+        if (best_edge < 0 || dist < best_dist) {
+          best_edge = i;
+          best_dist = dist;
+          best_normal = normal;
+        }
+      }
+      if (best_edge < 0) break;
+
+      ++out.iterations;
+      const detail::SimplexVertex sv = detail::support_vertex(a, xfa, b, xfb, best_normal);
+      if (best_normal.dot(sv.w) - best_dist < 1e-9 || n == k_max_vertices) break;
+
+      int k = best_edge + 1;
+      for (int j = n; j > k; --j) poly[j] = poly[j - 1];
+      poly[k] = sv;
+      ++n;
+
+      // Drop neighbours the new vertex made reflex (or collinear) so the
+      // polytope stays the convex hull of its points
+      const auto reflex = [&](int i) {
+        const Vec2& prev = poly[(i + n - 1) % n].w;
+        const Vec2& next = poly[(i + 1) % n].w;
+        return (poly[i].w - prev).cross(next - poly[i].w) <= 0.0;
+      };
+      const auto erase = [&](int i) {
+        for (int j = i; j + 1 < n; ++j) poly[j] = poly[j + 1];
+        --n;
+      };
+      while (n > 3 && reflex((k + 1) % n)) {
+        const int i = (k + 1) % n;
+        erase(i);
+        if (i < k) --k;
+      }
+      while (n > 3 && reflex((k + n - 1) % n)) {
+        const int i = (k + n - 1) % n;
+        erase(i);
+        if (i < k) --k;
+      }
+    }
+  }
+
+  if (best_edge < 0) {
+    // Flat Minkowski difference: no meaningful axis, fall back to centers
+    const Vec2 d = xfb.p - xfa.p;
+    out.normal = d.length_sq() > 0.0 ? d.normalized() : Vec2{0.0, 1.0};
+    out.separation = -radii;
+    out.point_a = core.point_a + out.normal * a.radius;
+    out.point_b = core.point_b - out.normal * b.radius;
+    return out;
+  }
+
+  // Closest boundary point best_dist * n lies on edge (p0, p1); the
+  // separating motion of B is along -n, so the A->B normal is -n
+  const detail::SimplexVertex& p0 = poly[best_edge];
+  const detail::SimplexVertex& p1 = poly[(best_edge + 1) % n];
+  const Vec2 e = p1.w - p0.w;
+  double t = -p0.w.dot(e) / e.length_sq();
+  t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+
+  out.normal = -best_normal;
+  out.separation = -best_dist - radii;
+  out.point_a = p0.wa.lerp(p1.wa, t) + out.normal * a.radius;
+  out.point_b = p0.wb.lerp(p1.wb, t) - out.normal * b.radius;
+  return out;
+}
+
+} // namespace sim
+
+#endif // SIM_GJK_HPP
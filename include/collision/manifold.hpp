@@ -0,0 +1,57 @@
+#pragma once
+#ifndef SIM_MANIFOLD_HPP
+#define SIM_MANIFOLD_HPP
+// include/collision/manifold.hpp
+// Contact manifold produced by the narrowphase
+//
+// Design notes:
+//  - At most two points: enough to rest a 2D polygon on a face, and
+//    keeps per-contact solver cost bounded
+//  - Feature ids let the solver match points across steps for warm
+//    starting
+
+#include "../math/vec2.hpp"
+#include <array>
+#include <cstdint>
+
+namespace sim {
+
+/// Maximum number of points in a manifold (2D face-face contact)
+inline constexpr int kMaxManifoldPoints = 2;
+
+/// Collision tolerance used for reference face selection and point
+/// merging (world units)
+inline constexpr double kLinearSlop = 0.005;
+
+// -----------------------------
+// Contact Point
+// -----------------------------
+struct ContactPoint {
+  Vec2 point{};             ///< world-space midpoint between the surfaces
+  double separation{0.0};   ///< negative when penetrating
+  std::uint32_t id{0};      ///< packed feature pair (see make_feature_id)
+};
+
+// -----------------------------
+// Contact Manifold
+// -----------------------------
+struct Manifold {
+  Vec2 normal{};            ///< world-space unit normal pointing from A to B
+  std::array<ContactPoint, kMaxManifoldPoints> points{};
+  int count{0};
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+};
+
+/// Pack reference face, incident vertex and flip flag into a feature id
+[[nodiscard]] constexpr std::uint32_t make_feature_id(int reference_face,
+                                                      int incident_vertex,
+                                                      bool flipped) noexcept {
+  return static_cast<std::uint32_t>(reference_face & 0xFF)
+       | (static_cast<std::uint32_t>(incident_vertex & 0xFF) << 8)
+       | (static_cast<std::uint32_t>(flipped ? 1 : 0) << 16);
+}
+
+} // namespace sim
+
+#endif // SIM_MANIFOLD_HPP
@@ -0,0 +1,125 @@
+#pragma once
+#ifndef SIM_POLYGON_HPP
+#define SIM_POLYGON_HPP
+// include/collision/polygon.hpp
+// Convex polygon shape used by the narrowphase
+//
+// Design notes:
+//  - Fixed capacity (no heap) so shapes can live in flat arrays
+//  - Vertices are counter-clockwise; normals[i] is the outward unit
+//    normal of the edge vertices[i] -> vertices[i + 1]
+//  - Vertices are in the shape's local frame
+
+#include "../math/vec2.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace sim {
+
+/// Maximum vertex count of a convex polygon
+inline constexpr int kMaxPolygonVertices = 8;
+
+// -----------------------------
+// Convex Polygon
+// -----------------------------
+struct Polygon {
+  std::array<Vec2, kMaxPolygonVertices> vertices{};
+  std::array<Vec2, kMaxPolygonVertices> normals{};
+  Vec2 centroid{};
+  int count{0};
+
+  /// Index of the vertex furthest along direction d
+  [[nodiscard]] constexpr int support(const Vec2& d) const noexcept {
+    int best = 0;
+    double best_dot = vertices[0].dot(d);
+    for (int i = 1; i < count; ++i) {
+      const double v = vertices[i].dot(d);
+      if (v > best_dot) {
+        best_dot = v;
+        best = i;
+      }
+    }
+    return best;
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Factories
+// ─────────────────────────────────────────────────────────────
+
+/// Build a polygon from counter-clockwise convex points.
+/// Points beyond kMaxPolygonVertices are ignored; fewer than three
+/// points yield an empty polygon (count == 0).
+[[nodiscard]] inline Polygon make_polygon(std::span<const Vec2> points) noexcept {
+  Polygon poly;
+  const int n = static_cast<int>(points.size()) < kMaxPolygonVertices
+                  ? static_cast<int>(points.size())
+                  : kMaxPolygonVertices;
+  if (n < 3) return poly;
+
+  poly.count = n;
+  double area = 0.0;
+  Vec2 c{};
+  for (int i = 0; i < n; ++i) {
+    const Vec2& v0 = points[i];
+    const Vec2& v1 = points[(i + 1) % n];
+    poly.vertices[i] = v0;
+    // Outward normal of a CCW edge is the clockwise perpendicular
+    poly.normals[i] = (-(v1 - v0).perpendicular()).normalized();
+
+    const double a = 0.5 * v0.cross(v1);
+    area += a;
+    c += (v0 + v1) * (a / 3.0);
+  }
+  poly.centroid = area > 0.0 ? c / area : points[0];
+  return poly;
+}
+
+/// Axis-aligned box centred on the origin
+[[nodiscard]] inline Polygon make_box(double half_width, double half_height) noexcept {
+  const std::array<Vec2, 4> pts{
+    Vec2{-half_width, -half_height}, Vec2{half_width, -half_height},
+    Vec2{half_width, half_height},   Vec2{-half_width, half_height}};
+  return make_polygon(pts);
+}
+
+// ─────────────────────────────────────────────────────────────
+// Mass Properties
+// ─────────────────────────────────────────────────────────────
+
+struct MassData {
+  double mass{0.0};
+  Vec2 center{};          ///< centre of mass, local frame
+  double inertia{0.0};    ///< about the centre of mass
+};
+
+/// Mass, centroid and rotational inertia of a solid polygon
+[[nodiscard]] inline MassData compute_mass(const Polygon& poly, double density) noexcept {
+  MassData md;
+  if (poly.count < 3) return md;
+  // Triangle fan about the first vertex keeps the terms well conditioned
+  const Vec2 origin = poly.vertices[0];
+  double area = 0.0;
+  Vec2 c{};
+  double i_origin = 0.0;
+  for (int i = 1; i + 1 < poly.count; ++i) {
+    const Vec2 e1 = poly.vertices[i] - origin;
+    const Vec2 e2 = poly.vertices[i + 1] - origin;
+    const double a = 0.5 * e1.cross(e2);
+    area += a;
+    c += (e1 + e2) * (a / 3.0);
+    i_origin += a / 6.0 * (e1.dot(e1) + e1.dot(e2) + e2.dot(e2));
+  }
+  if (area <= 0.0) return md;
+  c /= area;
+  md.mass = density * area;
+  md.center = origin + c;
+  // Parallel axis theorem: move from the fan origin to the centroid
+  md.inertia = density * i_origin - md.mass * c.dot(c);
+  return md;
+}
+
+} // namespace sim
+
+#endif // SIM_POLYGON_HPP
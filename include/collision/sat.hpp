@@ -0,0 +1,195 @@
+#pragma once
+#ifndef SIM_SAT_HPP
+#define SIM_SAT_HPP
+// include/collision/sat.hpp
+// Polygon-polygon narrowphase: separating axis test + face clipping
+//
+// Design notes:
+//  - All work happens in A's local frame; B is mapped into it once
+//  - SatCache remembers the axis of maximum separation per pair. When
+//    the pair is still separated along it, the test exits after one
+//    axis instead of scanning every face of both polygons
+//  - Reference/incident face clipping yields at most two points, which
+//    are merged into one when they coincide
+
+#include "manifold.hpp"
+#include "polygon.hpp"
+#include "../math/transform2.hpp"
+#include <cstdint>
+
+namespace sim {
+
+// -----------------------------
+// Separating Axis Cache
+// -----------------------------
+/// Per-pair cache of the last separating (or least penetrating) axis.
+/// Store one per broadphase pair and pass it back every step.
+struct SatCache {
+  enum class Axis : std::uint8_t { none, face_a, face_b };
+
+  Axis axis{Axis::none};
+  std::uint8_t index{0};   ///< face index on the polygon named by axis
+};
+
+namespace detail {
+
+/// Minimum separation of poly2 along face i of poly1 (same frame)
+[[nodiscard]] constexpr double face_separation(const Polygon& poly1, int i,
+                                               const Polygon& poly2) noexcept {
+  const Vec2& n = poly1.normals[i];
+  const Vec2& v = poly1.vertices[i];
+  const int j = poly2.support(-n);
+  return n.dot(poly2.vertices[j] - v);
+}
+
+/// Face of poly1 with the largest separation from poly2
+constexpr double find_max_separation(const Polygon& poly1, const Polygon& poly2,
+                                     int& best_face) noexcept {
+  best_face = 0;
+  double best = face_separation(poly1, 0, poly2);
+  for (int i = 1; i < poly1.count; ++i) {
+    const double s = face_separation(poly1, i, poly2);
+    if (s > best) {
+      best = s;
+      best_face = i;
+    }
+  }
+  return best;
+}
+
+struct ClipVertex {
+  Vec2 v{};
+  int vertex{0};   ///< incident vertex index the point originated from
+};
+
+/// Sutherland-Hodgman against a single plane: keep dot(n, v) <= offset
+constexpr int clip_segment(const ClipVertex in[2], ClipVertex out[2],
+                           const Vec2& n, double offset) noexcept {
+  int count = 0;
+  const double d0 = n.dot(in[0].v) - offset;
+  const double d1 = n.dot(in[1].v) - offset;
+
+  if (d0 <= 0.0) out[count++] = in[0];
+  if (d1 <= 0.0) out[count++] = in[1];
+
+  if (d0 * d1 < 0.0) {
+    const double t = d0 / (d0 - d1);
+    out[count].v = in[0].v.lerp(in[1].v, t);
+    out[count].vertex = d0 > 0.0 ? in[0].vertex : in[1].vertex;
+    ++count;
+  }
+  return count;
+}
+
+/// Polygon b re-expressed in the frame of a (xf = xfa^-1 * xfb)
+[[nodiscard]] constexpr Polygon to_frame(const Polygon& b, const Transform2& xf) noexcept {
+  Polygon out = b;
+  for (int i = 0; i < b.count; ++i) {
+    out.vertices[i] = xf.apply(b.vertices[i]);
+    out.normals[i] = xf.q.apply(b.normals[i]);
+  }
+  out.centroid = xf.apply(b.centroid);
+  return out;
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────
+// Narrowphase
+// ─────────────────────────────────────────────────────────────
+
+/// Collide two convex polygons. Returns an empty manifold when they are
+/// separated by more than speculative_distance. The cache is updated
+/// with the axis of maximum separation for the next call.
+[[nodiscard]] inline Manifold collide_polygons(const Polygon& poly_a, const Transform2& xfa,
+                                               const Polygon& poly_b, const Transform2& xfb,
+                                               SatCache& cache,
+                                               double speculative_distance = 0.0) noexcept {
+  Manifold m;
+  if (poly_a.count == 0 || poly_b.count == 0) return m;
+
+  const Polygon b = detail::to_frame(poly_b, xfa.inv_mul(xfb));
+  const Polygon& a = poly_a;
+
+  // Early out on last step's axis: coherent pairs rarely change it
+  if (cache.axis == SatCache::Axis::face_a && cache.index < a.count) {
+    if (detail::face_separation(a, cache.index, b) > speculative_distance) return m;
+  } else if (cache.axis == SatCache::Axis::face_b && cache.index < b.count) {
+    if (detail::face_separation(b, cache.index, a) > speculative_distance) return m;
+  }
+
+  int edge_a = 0;
+  const double sep_a = detail::find_max_separation(a, b, edge_a);
+  if (sep_a > speculative_distance) {
+    cache = SatCache{SatCache::Axis::face_a, static_cast<std::uint8_t>(edge_a)};
+    return m;
+  }
+
+  int edge_b = 0;
+  const double sep_b = detail::find_max_separation(b, a, edge_b);
+  if (sep_b > speculative_distance) {
+    cache = SatCache{SatCache::Axis::face_b, static_cast<std::uint8_t>(edge_b)};
+    return m;
+  }
+
+  // Prefer A as reference unless B is clearly better; avoids flip-flopping
+  constexpr double k_rel_tol = 0.98;
+  constexpr double k_abs_tol = 0.1 * kLinearSlop;
+  const bool flip = sep_b > k_rel_tol * sep_a + k_abs_tol;
+
+  const Polygon& ref = flip ? b : a;
+  const Polygon& inc = flip ? a : b;
+  const int ref_face = flip ? edge_b : edge_a;
+  cache = SatCache{flip ? SatCache::Axis::face_b : SatCache::Axis::face_a,
+                   static_cast<std::uint8_t>(ref_face)};
+
+  const Vec2 n = ref.normals[ref_face];
+
+  // Incident face: the one most anti-parallel to the reference normal
+  int inc_face = 0;
+  double min_dot = n.dot(inc.normals[0]);
+  for (int i = 1; i < inc.count; ++i) {
+    const double d = n.dot(inc.normals[i]);
+    if (d < min_dot) {
+      min_dot = d;
+      inc_face = i;
+    }
+  }
+  const int inc_next = inc_face + 1 < inc.count ? inc_face + 1 : 0;
+
+  const Vec2 r1 = ref.vertices[ref_face];
+  const Vec2 r2 = ref.vertices[ref_face + 1 < ref.count ? ref_face + 1 : 0];
+  const Vec2 tangent = (r2 - r1).normalized();
+
+  const detail::ClipVertex incident[2]{{inc.vertices[inc_face], inc_face},
+                                       {inc.vertices[inc_next], inc_next}};
+  detail::ClipVertex clip1[2];
+  detail::ClipVertex clip2[2];
+  if (detail::clip_segment(incident, clip1, -tangent, -tangent.dot(r1)) < 2) return m;
+  if (detail::clip_segment(clip1, clip2, tangent, tangent.dot(r2)) < 2) return m;
+
+  // Keep points within the speculative margin, measured from the reference face
+  for (const auto& cv : clip2) {
+    const double separation = n.dot(cv.v - r1);
+    if (separation > speculative_distance) continue;
+
+    ContactPoint& cp = m.points[m.count++];
+    cp.point = xfa.apply(cv.v - n * (0.5 * separation));
+    cp.separation = separation;
+    cp.id = make_feature_id(ref_face, cv.vertex, flip);
+  }
+
+  // Contact reduction: coincident points add solver cost but no support
+  if (m.count == 2 &&
+      m.points[0].point.distance_sq_to(m.points[1].point) < kLinearSlop * kLinearSlop) {
+    if (m.points[1].separation < m.points[0].separation) m.points[0] = m.points[1];
+    m.count = 1;
+  }
+
+  m.normal = xfa.q.apply(flip ? -n : n);
+  return m;
+}
+
+} // namespace sim
+
+#endif // SIM_SAT_HPP
@@ -0,0 +1,146 @@
+#pragma once
+#ifndef SIM_SENSOR_HPP
+#define SIM_SENSOR_HPP
+// include/collision/sensor.hpp
+// Sensor (trigger) overlap tracking driven by broadphase pair changes
+//
+// Design notes:
+//  - No per-sensor queries: candidate pairs are added and removed from
+//    Broadphase::changes(), so idle sensors cost nothing per step
+//  - A candidate is re-tested only when one of its colliders' revisions
+//    changed; the GJK simplex is cached per candidate for warm starts
+//  - Sensor-vs-sensor pairs are ignored
+//  - update() must run once after every Broadphase::update_pairs(),
+//    otherwise pair changes are missed
+
+#include "collider.hpp"
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace sim {
+
+struct SensorEvent {
+  std::uint32_t sensor{0};   ///< collider index of the sensor
+  std::uint32_t visitor{0};  ///< collider index of the overlapping shape
+
+  [[nodiscard]] constexpr bool operator==(const SensorEvent&) const noexcept = default;
+};
+
+/// Overlaps that began or ended during the last update()
+struct SensorEvents {
+  std::vector<SensorEvent> begin;
+  std::vector<SensorEvent> end;
+
+  void clear() noexcept {
+    begin.clear();
+    end.clear();
+  }
+};
+
+// -----------------------------
+// Sensor System
+// -----------------------------
+class SensorSystem {
+public:
+  /// Consume the broadphase's latest pair changes and refresh overlap
+  /// state; the resulting events replace the previous step's
+  void update(const Broadphase& broadphase, std::span<const Collider> colliders) {
+    events_.clear();
+    const PairChanges& changes = broadphase.changes();
+
+    for (const BroadphasePair& pair : changes.ended) {
+      const auto it = lookup_.find(key(pair));
+      if (it == lookup_.end()) continue;
+      const std::size_t i = it->second;
+      if (candidates_[i].touching) {
+        events_.end.push_back(SensorEvent{candidates_[i].sensor, candidates_[i].visitor});
+      }
+      lookup_.erase(it);
+      remove_at(i);
+    }
+
+    for (const BroadphasePair& pair : changes.begun) {
+      const std::uint32_t ua = broadphase.user_data(pair.a);
+      const std::uint32_t ub = broadphase.user_data(pair.b);
+      const bool sa = colliders[ua].is_sensor;
+      const bool sb = colliders[ub].is_sensor;
+      if (sa == sb) continue;  // neither, or both sensors
+
+      Candidate c;
+      c.pair = pair;
+      c.sensor = sa ? ua : ub;
+      c.visitor = sa ? ub : ua;
+      lookup_.emplace(key(pair), candidates_.size());
+      candidates_.push_back(c);
+    }
+
+    for (Candidate& c : candidates_) {
+      const Collider& s = colliders[c.sensor];
+      const Collider& v = colliders[c.visitor];
+      if (c.tested && c.sensor_revision == s.revision && c.visitor_revision == v.revision) {
+        continue;
+      }
+      ++narrow_tests_;
+      c.tested = true;
+      c.sensor_revision = s.revision;
+      c.visitor_revision = v.revision;
+
+      const bool touching =
+        gjk_distance(s.shape, s.transform, v.shape, v.transform, c.cache).distance <= 0.0;
+      if (touching == c.touching) continue;
+      c.touching = touching;
+      (touching ? events_.begin : events_.end).push_back(SensorEvent{c.sensor, c.visitor});
+    }
+  }
+
+  [[nodiscard]] const SensorEvents& events() const noexcept { return events_; }
+
+  /// Call fn(SensorEvent) for every overlap currently in progress
+  template<typename Fn>
+  void for_each_overlap(Fn&& fn) const {
+    for (const Candidate& c : candidates_) {
+      if (c.touching) fn(SensorEvent{c.sensor, c.visitor});
+    }
+  }
+
+  /// Sensor/visitor pairs whose fat boxes overlap
+  [[nodiscard]] std::size_t candidate_count() const noexcept { return candidates_.size(); }
+  /// Running count of overlap tests, for profiling
+  [[nodiscard]] std::uint64_t narrow_tests() const noexcept { return narrow_tests_; }
+
+private:
+  struct Candidate {
+    BroadphasePair pair{};
+    std::uint32_t sensor{0};
+    std::uint32_t visitor{0};
+    std::uint32_t sensor_revision{0};
+    std::uint32_t visitor_revision{0};
+    SimplexCache cache{};
+    bool tested{false};
+    bool touching{false};
+  };
+
+  [[nodiscard]] static constexpr std::uint64_t key(const BroadphasePair& p) noexcept {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(p.a)) << 32) |
+           static_cast<std::uint32_t>(p.b);
+  }
+
+  void remove_at(std::size_t i) {
+    if (i + 1 != candidates_.size()) {
+      candidates_[i] = candidates_.back();
+      lookup_[key(candidates_[i].pair)] = i;
+    }
+    candidates_.pop_back();
+  }
+
+  std::vector<Candidate> candidates_;
+  std::unordered_map<std::uint64_t, std::size_t> lookup_;
+  SensorEvents events_;
+  std::uint64_t narrow_tests_{0};
+};
+
+} // namespace sim
+
+#endif // SIM_SENSOR_HPP
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef SIM_SHAPE_CAST_HPP
+#define SIM_SHAPE_CAST_HPP
+// include/collision/shape_cast.hpp
+// Linear shape cast (time of impact) by conservative advancement
+//
+// Design notes:
+//  - Built on gjk_distance: each iteration advances B by the current
+//    gap divided by the closing speed, which can never overshoot
+//  - Translation only; rotating casts are not needed by the kinematic
+//    users (character controller, sweeps)
+
+#include "gjk.hpp"
+
+namespace sim {
+
+struct CastOutput {
+  bool hit{false};
+  double fraction{1.0};   ///< fraction of the translation at first contact
+  Vec2 normal{};          ///< unit normal pointing from A towards B
+  Vec2 point{};           ///< contact point on A (world)
+  bool initially_overlapping{false};
+  int iterations{0};
+};
+
+/// Sweep B along translation_b against static A. A hit is reported when
+/// the gap falls to target_separation (e.g. a contact skin).
+[[nodiscard]] inline CastOutput shape_cast(const ConvexProxy& a, const Transform2& xfa,
+                                           const ConvexProxy& b, const Transform2& xfb,
+                                           const Vec2& translation_b,
+                                           double target_separation = 0.0) noexcept {
+  constexpr int k_max_iterations = 20;
+  constexpr double k_tolerance = 1e-6;
+
+  CastOutput out;
+  SimplexCache cache;
+  double t = 0.0;
+
+  for (int iter = 0; iter < k_max_iterations; ++iter) {
+    out.iterations = iter + 1;
+    Transform2 xf = xfb;
+    xf.p += translation_b * t;
+
+    const DistanceOutput d = gjk_distance(a, xfa, b, xf, cache, true);
+    if (d.normal.length_sq() == 0.0) {
+      // Cores overlap: only EPA knows a sensible push-out direction
+      SimplexCache epa_cache = cache;
+      out.hit = true;
+      out.initially_overlapping = true;
+      out.fraction = t;
+      out.normal = epa_penetration(a, xfa, b, xf, epa_cache).normal;
+      out.point = d.point_a;
+      return out;
+    }
+
+    // Distance along a linear path is convex: once it stops shrinking
+    // it never shrinks again, so touching-but-separating is a miss
+    const double closing = -translation_b.dot(d.normal);
+    if (closing <= k_tolerance * k_tolerance) return out;
+
+    if (d.distance <= target_separation + k_tolerance) {
+      out.hit = true;
+      out.fraction = t;
+      out.normal = d.normal;
+      out.point = d.point_a;
+      out.initially_overlapping = t == 0.0 && d.distance < target_separation - k_tolerance;
+      return out;
+    }
+
+    t += (d.distance - target_separation) / closing;
+    if (t >= 1.0) return out;
+  }
+  return out;
+}
+
+} // namespace sim
+
+#endif // SIM_SHAPE_CAST_HPP
@@ -5,6 +5,7 @@
 // Shared concepts used throughout the project
 
 #include <concepts>
+#include <type_traits>
 
 namespace sim {
 
@@ -12,6 +13,15 @@ namespace sim {
 template<typename T>
 concept Scalar = std::floating_point<T> || std::integral<T>;
 
+/// Opt-in for number-like class types (e.g. automatic-differentiation
+/// duals) that support the arithmetic vector code needs
+template<typename T>
+struct is_number_like : std::false_type {};
+
+/// Scalar, or a class type that opted in through is_number_like
+template<typename T>
+concept NumberLike = Scalar<T> || is_number_like<T>::value;
+
 } // namespace sim
 
 #endif // SIM_CONCEPTS_HPP
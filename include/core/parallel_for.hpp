@@ -0,0 +1,134 @@
+#pragma once
+#ifndef SIM_PARALLEL_FOR_HPP
+#define SIM_PARALLEL_FOR_HPP
+// include/core/parallel_for.hpp
+// Persistent worker threads running index-parallel loops
+//
+// Design notes:
+//  - Workers are started once and sleep between loops, so a per-frame
+//    parallel_for costs a wake-up, not a thread spawn
+//  - Indices are handed out from an atomic counter in small chunks, which
+//    balances uneven work (e.g. tiles with very different particle
+//    counts) without a scheduler
+//  - The calling thread takes part in the loop; a pool with zero workers
+//    runs everything inline, which keeps single-threaded builds and
+//    debugging simple
+//  - Loops must not be nested or run concurrently on one pool
+
+#include <algorithm>  // std::min
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Task Pool
+// -----------------------------
+class TaskPool {
+public:
+  /// workers == 0 runs loops on the calling thread only
+  explicit TaskPool(unsigned workers = default_workers()) {
+    threads_.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) threads_.emplace_back([this] { worker(); });
+  }
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  ~TaskPool() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : threads_) t.join();
+  }
+
+  /// Hardware threads minus the caller
+  [[nodiscard]] static unsigned default_workers() noexcept {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? hw - 1 : 0;
+  }
+
+  /// Call fn(i) for every i in [0, count); returns when all calls are done
+  void parallel_for(std::size_t count, const std::function<void(std::size_t)>& fn,
+                    std::size_t chunk = 1) {
+    if (count == 0) return;
+    if (threads_.empty() || count <= chunk) {
+      for (std::size_t i = 0; i < count; ++i) fn(i);
+      return;
+    }
+    {
+      std::lock_guard lock(mutex_);
+      fn_ = &fn;
+      count_ = count;
+      chunk_ = chunk > 0 ? chunk : 1;
+      next_.store(0, std::memory_order_relaxed);
+      active_ = threads_.size();
+      ++generation_;
+    }
+    wake_.notify_all();
+    run_chunks();
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    fn_ = nullptr;
+  }
+
+  [[nodiscard]] std::size_t workers() const noexcept { return threads_.size(); }
+
+private:
+  void run_chunks() {
+    for (;;) {
+      const std::size_t begin = next_.fetch_add(chunk_, std::memory_order_relaxed);
+      if (begin >= count_) return;
+      const std::size_t end = std::min(begin + chunk_, count_);
+      for (std::size_t i = begin; i < end; ++i) (*fn_)(i);
+    }
+  }
+
+  void worker() {
+    std::uint64_t seen = 0;
+    std::unique_lock lock(mutex_);
+    for (;;) {
+      wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+      if (stopping_) return;
+      seen = generation_;
+      lock.unlock();
+      run_chunks();
+      lock.lock();
+      if (--active_ == 0) done_.notify_one();
+    }
+  }
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(std::size_t)>* fn_{nullptr};
+  std::size_t count_{0};
+  std::size_t chunk_{1};
+  std::atomic<std::size_t> next_{0};
+  std::size_t active_{0};
+  std::uint64_t generation_{0};
+  bool stopping_{false};
+};
+
+/// Run fn(i) for i in [0, count) on pool, or inline when pool is null
+inline void parallel_for(TaskPool* pool, std::size_t count,
+                         const std::function<void(std::size_t)>& fn, std::size_t chunk = 1) {
+  if (pool != nullptr) {
+    pool->parallel_for(count, fn, chunk);
+  } else {
+    for (std::size_t i = 0; i < count; ++i) fn(i);
+  }
+}
+
+} // namespace sim
+
+#endif // SIM_PARALLEL_FOR_HPP
@@ -0,0 +1,194 @@
+#pragma once
+#ifndef SIM_POOL_HPP
+#define SIM_POOL_HPP
+// include/core/pool.hpp
+// Typed object pool: free-list slots in cache-line-aligned slabs,
+// addressed by generation-checked handles
+//
+// Design notes:
+//  - Objects live in fixed-size slabs that are never moved or freed
+//    until the pool dies, so pointers stay valid while an object lives
+//    and spawn/despawn cycles reuse memory without touching the heap
+//  - Freed slots go on a LIFO free list: the next spawn reuses the most
+//    recently freed (still cache-warm) slot
+//  - Handles carry a generation; destroying an object bumps it, so stale
+//    handles resolve to nullptr instead of aliasing a newer object
+//  - Slot metadata (generation, liveness, free-list link) is kept in
+//    separate arrays so the slabs hold nothing but objects
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/// Generation-checked reference to an object in a Pool<T>
+template<typename T>
+struct Handle {
+  static constexpr std::uint32_t kInvalidIndex = 0xFFFF'FFFFu;
+
+  std::uint32_t index{kInvalidIndex};
+  std::uint32_t generation{0};
+
+  [[nodiscard]] constexpr bool is_null() const noexcept { return index == kInvalidIndex; }
+  [[nodiscard]] constexpr bool operator==(const Handle&) const noexcept = default;
+};
+
+struct PoolStats {
+  std::size_t live{0};
+  std::size_t capacity{0};        ///< slots in all slabs
+  std::size_t slabs{0};
+  std::size_t peak_live{0};
+  std::uint64_t creations{0};
+  std::uint64_t reuses{0};        ///< creations served from the free list
+  std::uint64_t slab_allocations{0};
+
+  [[nodiscard]] constexpr double occupancy() const noexcept {
+    return capacity == 0 ? 0.0 : static_cast<double>(live) / static_cast<double>(capacity);
+  }
+};
+
+// -----------------------------
+// Pool
+// -----------------------------
+template<typename T, std::size_t SlabSize = 64>
+class Pool {
+  static_assert(SlabSize > 0, "slabs must hold at least one object");
+
+public:
+  using handle_type = Handle<T>;
+
+  Pool() = default;
+  Pool(const Pool&) = delete;
+  Pool& operator=(const Pool&) = delete;
+  Pool(Pool&& other) noexcept { swap(other); }
+  Pool& operator=(Pool&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+  ~Pool() { clear(); }
+
+  void swap(Pool& other) noexcept {
+    using std::swap;
+    swap(slabs_, other.slabs_);
+    swap(generation_, other.generation_);
+    swap(alive_, other.alive_);
+    swap(next_free_, other.next_free_);
+    swap(next_unused_, other.next_unused_);
+    swap(free_head_, other.free_head_);
+    swap(stats_, other.stats_);
+  }
+
+  template<typename... Args>
+  handle_type create(Args&&... args) {
+    std::uint32_t index;
+    if (free_head_ != kEnd) {
+      index = free_head_;
+      free_head_ = next_free_[index];
+      ++stats_.reuses;
+    } else {
+      if (next_unused_ == stats_.capacity) grow();
+      index = static_cast<std::uint32_t>(next_unused_++);
+    }
+    ::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+    alive_[index] = 1;
+    ++stats_.live;
+    ++stats_.creations;
+    if (stats_.live > stats_.peak_live) stats_.peak_live = stats_.live;
+    return handle_type{index, generation_[index]};
+  }
+
+  /// Destroy the object; returns false for null or stale handles
+  bool destroy(handle_type h) {
+    if (!alive(h)) return false;
+    slot(h.index)->~T();
+    alive_[h.index] = 0;
+    ++generation_[h.index];
+    next_free_[h.index] = free_head_;
+    free_head_ = h.index;
+    --stats_.live;
+    return true;
+  }
+
+  [[nodiscard]] bool alive(handle_type h) const noexcept {
+    return h.index < next_unused_ && alive_[h.index] != 0 && generation_[h.index] == h.generation;
+  }
+
+  /// nullptr for null or stale handles
+  [[nodiscard]] T* get(handle_type h) noexcept { return alive(h) ? slot(h.index) : nullptr; }
+  [[nodiscard]] const T* get(handle_type h) const noexcept { return alive(h) ? slot(h.index) : nullptr; }
+
+  /// Make room for n live objects without further slab allocations
+  void reserve(std::size_t n) {
+    while (stats_.capacity < n) grow();
+  }
+
+  /// Destroy every object; slabs are kept for reuse
+  void clear() noexcept {
+    for (std::size_t i = 0; i < next_unused_; ++i) {
+      if (alive_[i] == 0) continue;
+      slot(static_cast<std::uint32_t>(i))->~T();
+      alive_[i] = 0;
+      ++generation_[i];
+    }
+    next_unused_ = 0;
+    free_head_ = kEnd;
+    stats_.live = 0;
+  }
+
+  /// Call fn(handle, T&) for every live object, in slot order
+  template<typename Fn>
+  void for_each(Fn&& fn) {
+    for (std::size_t i = 0; i < next_unused_; ++i) {
+      if (alive_[i] == 0) continue;
+      const auto index = static_cast<std::uint32_t>(i);
+      fn(handle_type{index, generation_[i]}, *slot(index));
+    }
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return stats_.live; }
+  [[nodiscard]] bool empty() const noexcept { return stats_.live == 0; }
+  [[nodiscard]] const PoolStats& stats() const noexcept { return stats_; }
+
+private:
+  static constexpr std::uint32_t kEnd = 0xFFFF'FFFFu;
+
+  struct alignas(kCacheLineSize) Slab {
+    alignas(T) std::byte storage[sizeof(T) * SlabSize];
+  };
+
+  [[nodiscard]] T* slot(std::uint32_t index) const noexcept {
+    Slab& s = *slabs_[index / SlabSize];
+    return std::launder(reinterpret_cast<T*>(s.storage + sizeof(T) * (index % SlabSize)));
+  }
+
+  void grow() {
+    slabs_.push_back(std::unique_ptr<Slab>(new Slab));  // storage left uninitialised
+    stats_.capacity += SlabSize;
+    ++stats_.slabs;
+    ++stats_.slab_allocations;
+    generation_.resize(stats_.capacity, 1);
+    alive_.resize(stats_.capacity, 0);
+    next_free_.resize(stats_.capacity, kEnd);
+  }
+
+  std::vector<std::unique_ptr<Slab>> slabs_;
+  std::vector<std::uint32_t> generation_;
+  std::vector<std::uint8_t> alive_;
+  std::vector<std::uint32_t> next_free_;
+  std::size_t next_unused_{0};
+  std::uint32_t free_head_{kEnd};
+  PoolStats stats_{};
+};
+
+} // namespace sim
+
+#endif // SIM_POOL_HPP
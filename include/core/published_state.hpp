@@ -0,0 +1,64 @@
+#pragma once
+#ifndef SIM_PUBLISHED_STATE_HPP
+#define SIM_PUBLISHED_STATE_HPP
+// include/core/published_state.hpp
+// Lock-free hand-off of state snapshots from the simulation thread to a
+// reader (UI, recorder), using a triple buffer
+//
+// Design notes:
+//  - Three slots: the writer owns one, the reader owns one, the third is
+//    the hand-off. publish() and acquire() each swap their slot with the
+//    hand-off slot in one atomic exchange, so neither side ever waits
+//  - The reader always sees the newest complete snapshot; snapshots it
+//    was too slow to read are skipped, never torn
+//  - Exactly one writer thread and one reader thread
+//  - Slots are reused, so snapshot containers keep their capacity and
+//    steady-state publishing does not allocate
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace sim {
+
+// -----------------------------
+// Published State
+// -----------------------------
+template<typename T>
+class PublishedState {
+public:
+  /// Slot the writer fills before calling publish()
+  [[nodiscard]] T& write_buffer() noexcept { return slots_[write_]; }
+
+  /// Hand the write buffer to the reader; the writer gets a free slot
+  void publish() noexcept {
+    const std::uint8_t prev = middle_.exchange(static_cast<std::uint8_t>(write_ | kFresh),
+                                               std::memory_order_acq_rel);
+    write_ = prev & kIndexMask;
+  }
+
+  /// Take the newest published snapshot, if there is one since the last
+  /// call. Returns false (and keeps the current read buffer) otherwise.
+  bool acquire() noexcept {
+    if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) return false;
+    const std::uint8_t prev = middle_.exchange(read_, std::memory_order_acq_rel);
+    read_ = prev & kIndexMask;
+    return true;
+  }
+
+  /// Snapshot owned by the reader (valid until the next acquire())
+  [[nodiscard]] const T& read_buffer() const noexcept { return slots_[read_]; }
+
+private:
+  static constexpr std::uint8_t kIndexMask = 0x3;
+  static constexpr std::uint8_t kFresh = 0x4;
+
+  std::array<T, 3> slots_{};
+  std::uint8_t write_{0};
+  std::uint8_t read_{1};
+  std::atomic<std::uint8_t> middle_{2};
+};
+
+} // namespace sim
+
+#endif // SIM_PUBLISHED_STATE_HPP
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef SIM_XORSHIFT_HPP
+#define SIM_XORSHIFT_HPP
+// include/core/xorshift.hpp
+// Small deterministic random number generator for scene and world setup
+//
+// Design notes:
+//  - xorshift32: the sequence depends only on the seed, so layouts are
+//    reproducible across platforms and standard libraries, unlike
+//    <random> distributions
+//  - Four bytes of state: cheap to keep one per world or per job
+//  - Not for statistics-heavy use; good enough for scattering particles
+//    and sites
+
+#include <cstdint>
+
+namespace sim {
+
+class XorShift32 {
+public:
+  /// A zero seed (the one fixed point of xorshift) is replaced by 1
+  explicit constexpr XorShift32(std::uint32_t seed = 1) noexcept : state_(seed != 0 ? seed : 1u) {}
+
+  constexpr std::uint32_t next_u32() noexcept {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 17;
+    state_ ^= state_ << 5;
+    return state_;
+  }
+
+  /// Uniform in [0, 1)
+  constexpr double next() noexcept { return static_cast<double>(next_u32()) / 4294967296.0; }
+
+  /// Uniform in [lo, hi)
+  constexpr double uniform(double lo, double hi) noexcept { return lo + (hi - lo) * next(); }
+
+private:
+  std::uint32_t state_;
+};
+
+} // namespace sim
+
+#endif // SIM_XORSHIFT_HPP
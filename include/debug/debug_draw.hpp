@@ -0,0 +1,258 @@
+#pragma once
+#ifndef SIM_DEBUG_DRAW_HPP
+#define SIM_DEBUG_DRAW_HPP
+// include/debug/debug_draw.hpp
+// Debug-draw command recording: per-thread append buffers during the
+// step, merged into one array per primitive type for batched rendering
+//
+// Design notes:
+//  - Everything is templated on a bool. DebugDrawBuffer<false> is an
+//    empty class whose members are empty inline functions, so recording
+//    calls, and the argument computations the optimiser can see through,
+//    vanish from builds with debug drawing off
+//  - SIM_DEBUG_DRAW picks the default (DebugDraw alias); it is on unless
+//    NDEBUG is defined
+//  - Each worker records into its own cache-line-aligned buffer, so
+//    recording takes no lock and threads do not share cache lines.
+//    merge() concatenates them once per frame
+//  - Primitives are stored as floats with a packed RGBA colour: the
+//    merged arrays can be uploaded as vertex data directly, one draw per
+//    primitive type
+
+#include "../collision/aabb.hpp"
+#include "../collision/manifold.hpp"
+#include "../collision/polygon.hpp"
+#include "../dynamics/rigid_body.hpp"
+#include "../math/transform2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#ifndef SIM_DEBUG_DRAW
+#ifdef NDEBUG
+#define SIM_DEBUG_DRAW 0
+#else
+#define SIM_DEBUG_DRAW 1
+#endif
+#endif
+
+namespace sim {
+
+inline constexpr bool kDebugDrawEnabled = SIM_DEBUG_DRAW != 0;
+
+/// Packed 0xRRGGBBAA
+using DebugColor = std::uint32_t;
+
+[[nodiscard]] constexpr DebugColor debug_rgba(std::uint8_t r, std::uint8_t g, std::uint8_t b,
+                                              std::uint8_t a = 255) noexcept {
+  return (std::uint32_t{r} << 24) | (std::uint32_t{g} << 16) | (std::uint32_t{b} << 8) | a;
+}
+
+namespace debug_colors {
+inline constexpr DebugColor kShape = debug_rgba(230, 230, 230);
+inline constexpr DebugColor kAabb = debug_rgba(255, 0, 255);
+inline constexpr DebugColor kContact = debug_rgba(255, 64, 64);
+inline constexpr DebugColor kNormal = debug_rgba(255, 220, 64);
+inline constexpr DebugColor kJoint = debug_rgba(64, 200, 255);
+inline constexpr DebugColor kGrid = debug_rgba(80, 80, 80);
+} // namespace debug_colors
+
+struct DebugLine {
+  float x0, y0, x1, y1;
+  DebugColor color;
+};
+
+struct DebugPoint {
+  float x, y, size;       ///< size in pixels
+  DebugColor color;
+};
+
+struct DebugCircle {
+  float x, y, radius;     ///< radius in world units
+  DebugColor color;
+};
+
+/// Recorded primitives, one array per type
+struct DebugDrawBatch {
+  std::vector<DebugLine> lines;
+  std::vector<DebugPoint> points;
+  std::vector<DebugCircle> circles;
+
+  void clear() noexcept {
+    lines.clear();
+    points.clear();
+    circles.clear();
+  }
+
+  void append(const DebugDrawBatch& o) {
+    lines.insert(lines.end(), o.lines.begin(), o.lines.end());
+    points.insert(points.end(), o.points.begin(), o.points.end());
+    circles.insert(circles.end(), o.circles.begin(), o.circles.end());
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return lines.size() + points.size() + circles.size(); }
+};
+
+// -----------------------------
+// Debug Draw Buffer
+// -----------------------------
+template<bool Enabled>
+class DebugDrawBuffer;
+
+/// Recording buffer for one thread
+template<>
+class DebugDrawBuffer<true> {
+public:
+  static constexpr bool enabled = true;
+
+  void line(const Vec2& a, const Vec2& b, DebugColor c) {
+    batch_.lines.push_back(DebugLine{static_cast<float>(a.x), static_cast<float>(a.y),
+                                     static_cast<float>(b.x), static_cast<float>(b.y), c});
+  }
+
+  void point(const Vec2& p, float size_px, DebugColor c) {
+    batch_.points.push_back(DebugPoint{static_cast<float>(p.x), static_cast<float>(p.y), size_px, c});
+  }
+
+  void circle(const Vec2& center, double radius, DebugColor c) {
+    batch_.circles.push_back(DebugCircle{static_cast<float>(center.x), static_cast<float>(center.y),
+                                         static_cast<float>(radius), c});
+  }
+
+  /// Line from p to p + dir
+  void arrow(const Vec2& p, const Vec2& dir, DebugColor c) { line(p, p + dir, c); }
+
+  void aabb(const AABB& box, DebugColor c = debug_colors::kAabb) {
+    const Vec2 lr{box.upper.x, box.lower.y};
+    const Vec2 ul{box.lower.x, box.upper.y};
+    line(box.lower, lr, c);
+    line(lr, box.upper, c);
+    line(box.upper, ul, c);
+    line(ul, box.lower, c);
+  }
+
+  void polygon(const Polygon& poly, const Transform2& xf, DebugColor c = debug_colors::kShape) {
+    for (int i = 0; i < poly.count; ++i) {
+      line(xf.apply(poly.vertices[i]), xf.apply(poly.vertices[(i + 1) % poly.count]), c);
+    }
+  }
+
+  /// Contact points and normals (normal_length in world units)
+  void manifold(const Manifold& m, double normal_length = 0.2) {
+    for (int i = 0; i < m.count; ++i) {
+      point(m.points[i].point, 4.0f, debug_colors::kContact);
+      arrow(m.points[i].point, m.normal * normal_length, debug_colors::kNormal);
+    }
+  }
+
+  /// Anchor lines of any joint def with body indices and local anchors
+  template<typename JointDef>
+  void joint(const JointDef& def, std::span<const RigidBody> bodies) {
+    const RigidBody& a = bodies[def.body_a];
+    const RigidBody& b = bodies[def.body_b];
+    const Vec2 pa = a.transform().apply(def.local_anchor_a);
+    const Vec2 pb = b.transform().apply(def.local_anchor_b);
+    line(a.position, pa, debug_colors::kJoint);
+    line(pa, pb, debug_colors::kJoint);
+    line(pb, b.position, debug_colors::kJoint);
+  }
+
+  /// Uniform grid lines over box
+  void grid(const AABB& box, double cell, DebugColor c = debug_colors::kGrid) {
+    if (cell <= 0.0) return;
+    for (double x = box.lower.x; x <= box.upper.x + 1e-9; x += cell) {
+      line(Vec2{x, box.lower.y}, Vec2{x, box.upper.y}, c);
+    }
+    for (double y = box.lower.y; y <= box.upper.y + 1e-9; y += cell) {
+      line(Vec2{box.lower.x, y}, Vec2{box.upper.x, y}, c);
+    }
+  }
+
+  void clear() noexcept { batch_.clear(); }
+  [[nodiscard]] const DebugDrawBatch& batch() const noexcept { return batch_; }
+
+private:
+  DebugDrawBatch batch_;
+};
+
+/// Disabled: every call is an empty inline function
+template<>
+class DebugDrawBuffer<false> {
+public:
+  static constexpr bool enabled = false;
+
+  constexpr void line(const Vec2&, const Vec2&, DebugColor) noexcept {}
+  constexpr void point(const Vec2&, float, DebugColor) noexcept {}
+  constexpr void circle(const Vec2&, double, DebugColor) noexcept {}
+  constexpr void arrow(const Vec2&, const Vec2&, DebugColor) noexcept {}
+  constexpr void aabb(const AABB&, DebugColor = 0) noexcept {}
+  constexpr void polygon(const Polygon&, const Transform2&, DebugColor = 0) noexcept {}
+  constexpr void manifold(const Manifold&, double = 0.0) noexcept {}
+  template<typename JointDef>
+  constexpr void joint(const JointDef&, std::span<const RigidBody>) noexcept {}
+  constexpr void grid(const AABB&, double, DebugColor = 0) noexcept {}
+  constexpr void clear() noexcept {}
+};
+
+// -----------------------------
+// Debug Draw
+// -----------------------------
+/// Per-thread buffers plus the merged batch handed to the renderer
+template<bool Enabled>
+class BasicDebugDraw {
+public:
+  static constexpr bool enabled = true;
+
+  explicit BasicDebugDraw(std::size_t threads = 1) : slots_(threads > 0 ? threads : 1) {}
+
+  /// Buffer for worker thread i; each thread must use its own index
+  [[nodiscard]] DebugDrawBuffer<true>& thread(std::size_t i = 0) noexcept { return slots_[i].buffer; }
+
+  /// Drop last frame's primitives
+  void begin_frame() noexcept {
+    for (Slot& s : slots_) s.buffer.clear();
+  }
+
+  /// Concatenate every thread's primitives, one array per type
+  const DebugDrawBatch& merge() {
+    merged_.clear();
+    for (const Slot& s : slots_) merged_.append(s.buffer.batch());
+    return merged_;
+  }
+
+  [[nodiscard]] const DebugDrawBatch& merged() const noexcept { return merged_; }
+  [[nodiscard]] std::size_t thread_count() const noexcept { return slots_.size(); }
+
+private:
+  // 64: typical cache line, so neighbouring threads' vectors don't share one
+  struct alignas(64) Slot {
+    DebugDrawBuffer<true> buffer;
+  };
+
+  std::vector<Slot> slots_;
+  DebugDrawBatch merged_;
+};
+
+template<>
+class BasicDebugDraw<false> {
+public:
+  static constexpr bool enabled = false;
+
+  explicit constexpr BasicDebugDraw(std::size_t = 1) noexcept {}
+  [[nodiscard]] DebugDrawBuffer<false>& thread(std::size_t = 0) noexcept { return buffer_; }
+  constexpr void begin_frame() noexcept {}
+  const DebugDrawBatch& merge() noexcept { return empty_; }
+  [[nodiscard]] const DebugDrawBatch& merged() const noexcept { return empty_; }
+  [[nodiscard]] constexpr std::size_t thread_count() const noexcept { return 0; }
+
+private:
+  [[no_unique_address]] DebugDrawBuffer<false> buffer_;
+  DebugDrawBatch empty_;
+};
+
+using DebugDraw = BasicDebugDraw<kDebugDrawEnabled>;
+
+} // namespace sim
+
+#endif // SIM_DEBUG_DRAW_HPP
@@ -0,0 +1,358 @@
+#pragma once
+#ifndef SIM_FP_VALIDATION_HPP
+#define SIM_FP_VALIDATION_HPP
+// include/debug/fp_validation.hpp
+// Floating-point validation: a checked scalar that carries a rounding
+// error bound and reports where a NaN/Inf first appeared, plus per-phase
+// finiteness scans for the engine's own step loops
+//
+// Design notes:
+//  - Checked is a double plus a first-order bound on its accumulated
+//    rounding error. An operation whose inputs are finite but whose result
+//    is not is an origin: it is reported with the operation and operands.
+//    Operations on already non-finite inputs only propagate, so the report
+//    names where the problem started, not every place it spread to
+//  - Reports are per thread and per step: FpStepScope starts a step,
+//    FpPhase labels the code running inside it, and only the first origin
+//    of a step is kept and passed to the hook; later ones are counted
+//  - Checked is NumberLike, so BasicVec2<Checked> and scalar-templated
+//    kernels (e.g. diff_step) run checked without changes. ValidationReal
+//    is Checked in validation builds and plain double otherwise
+//  - SIM_FP_VALIDATION controls the engine instrumentation (scopes,
+//    phases, fp_check_finite scans); it is on unless NDEBUG is defined.
+//    When off every call is an empty inline function. Define it to 1 in
+//    a release build to chase a NaN at full optimisation
+
+#include "../core/concepts.hpp"
+#include "../math/vec2.hpp"
+#include <atomic>
+#include <cmath>      // std::isfinite, std::sqrt, std::sin, std::cos, std::exp, std::log, std::pow
+#include <compare>    // std::partial_ordering
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#ifndef SIM_FP_VALIDATION
+#ifdef NDEBUG
+#define SIM_FP_VALIDATION 0
+#else
+#define SIM_FP_VALIDATION 1
+#endif
+#endif
+
+namespace sim {
+
+inline constexpr bool kFpValidation = SIM_FP_VALIDATION != 0;
+
+// -----------------------------
+// Reports
+// -----------------------------
+enum class FpOp : std::uint8_t {
+  add, sub, mul, div, neg, sqrt, sin, cos, exp, log, pow,
+  check,    ///< fp_check_finite scan of a state array
+};
+
+[[nodiscard]] constexpr const char* fp_op_name(FpOp op) noexcept {
+  switch (op) {
+    case FpOp::add: return "add";
+    case FpOp::sub: return "sub";
+    case FpOp::mul: return "mul";
+    case FpOp::div: return "div";
+    case FpOp::neg: return "neg";
+    case FpOp::sqrt: return "sqrt";
+    case FpOp::sin: return "sin";
+    case FpOp::cos: return "cos";
+    case FpOp::exp: return "exp";
+    case FpOp::log: return "log";
+    case FpOp::pow: return "pow";
+    case FpOp::check: return "check";
+  }
+  return "?";
+}
+
+inline constexpr std::size_t kFpNoIndex = static_cast<std::size_t>(-1);
+
+/// Where a non-finite value first appeared
+struct FpEvent {
+  FpOp op{FpOp::check};
+  double lhs{0.0};              ///< operands (rhs is 0 for unary operations)
+  double rhs{0.0};
+  double result{0.0};
+  std::uint64_t id{0};          ///< FpStepScope id, e.g. a world's seed
+  std::uint64_t step{0};
+  const char* phase{""};        ///< innermost FpPhase label
+  std::size_t index{kFpNoIndex};     ///< element, for FpOp::check
+  std::size_t component{0};          ///< which array of the scan, for FpOp::check
+};
+
+using FpReportHook = void (*)(const FpEvent&);
+
+/// Per-thread step context
+struct FpValidationState {
+  std::uint64_t id{0};
+  std::uint64_t step{0};
+  const char* phase{""};
+  std::uint64_t origins{0};     ///< non-finite origins seen this step
+  bool has_first{false};
+  FpEvent first{};
+};
+
+[[nodiscard]] inline FpValidationState& fp_validation_state() noexcept {
+  thread_local FpValidationState state;
+  return state;
+}
+
+namespace detail {
+[[nodiscard]] inline std::atomic<FpReportHook>& fp_hook_slot() noexcept {
+  static std::atomic<FpReportHook> hook{nullptr};
+  return hook;
+}
+} // namespace detail
+
+/// Hook called (on the reporting thread) with the first origin of each step
+inline void set_fp_report_hook(FpReportHook hook) noexcept {
+  detail::fp_hook_slot().store(hook, std::memory_order_release);
+}
+
+/// Record a non-finite origin in the calling thread's current step
+inline void fp_report(FpEvent e) noexcept {
+  FpValidationState& s = fp_validation_state();
+  ++s.origins;
+  if (s.has_first) return;
+  e.id = s.id;
+  e.step = s.step;
+  e.phase = s.phase;
+  s.first = e;
+  s.has_first = true;
+  if (const FpReportHook hook = detail::fp_hook_slot().load(std::memory_order_acquire)) hook(e);
+}
+
+/// First origin of the calling thread's current step, or nullptr
+[[nodiscard]] inline const FpEvent* fp_first_event() noexcept {
+  const FpValidationState& s = fp_validation_state();
+  return s.has_first ? &s.first : nullptr;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Step and phase scopes
+// ─────────────────────────────────────────────────────────────
+
+/// Starts a step on this thread: clears the previous step's report.
+/// The previous context is restored on exit, so scopes may nest.
+class FpStepScope {
+public:
+  explicit FpStepScope(std::uint64_t step, std::uint64_t id = 0) noexcept {
+    if constexpr (kFpValidation) {
+      FpValidationState& s = fp_validation_state();
+      saved_ = s;
+      s = FpValidationState{};
+      s.id = id;
+      s.step = step;
+    }
+  }
+  ~FpStepScope() {
+    if constexpr (kFpValidation) {
+      FpValidationState& s = fp_validation_state();
+      // An origin found here still counts against the enclosing step
+      const bool had = s.has_first;
+      const FpEvent first = s.first;
+      const std::uint64_t origins = s.origins;
+      s = saved_;
+      s.origins += origins;
+      if (had && !s.has_first) {
+        s.first = first;
+        s.has_first = true;
+      }
+    }
+  }
+  FpStepScope(const FpStepScope&) = delete;
+  FpStepScope& operator=(const FpStepScope&) = delete;
+
+private:
+  FpValidationState saved_{};
+};
+
+/// Labels reports from the enclosed code (a string literal; not copied)
+class FpPhase {
+public:
+  explicit FpPhase(const char* name) noexcept {
+    if constexpr (kFpValidation) {
+      FpValidationState& s = fp_validation_state();
+      saved_ = s.phase;
+      s.phase = name;
+    }
+  }
+  ~FpPhase() {
+    if constexpr (kFpValidation) fp_validation_state().phase = saved_;
+  }
+  FpPhase(const FpPhase&) = delete;
+  FpPhase& operator=(const FpPhase&) = delete;
+
+private:
+  const char* saved_{""};
+};
+
+/// Scan state arrays after a phase: reports the first non-finite element
+/// (array order, then index) as an FpOp::check origin. True when all are
+/// finite; always true when validation is compiled out.
+template<typename... Arrays>
+bool fp_check_finite(const char* phase, const Arrays&... arrays) noexcept {
+  if constexpr (kFpValidation) {
+    const std::span<const double> spans[] = {std::span<const double>(arrays)...};
+    for (std::size_t c = 0; c < sizeof...(Arrays); ++c) {
+      for (std::size_t i = 0; i < spans[c].size(); ++i) {
+        if (std::isfinite(spans[c][i])) continue;
+        const FpPhase label(phase);
+        FpEvent e;
+        e.op = FpOp::check;
+        e.result = spans[c][i];
+        e.index = i;
+        e.component = c;
+        fp_report(e);
+        return false;
+      }
+    }
+  } else {
+    (static_cast<void>(arrays), ...);
+    static_cast<void>(phase);
+  }
+  return true;
+}
+
+// -----------------------------
+// Checked Scalar
+// -----------------------------
+/// A double with a bound on its rounding error and NaN/Inf origin reports
+struct Checked {
+  /// Unit roundoff of double
+  static constexpr double kUnit = std::numeric_limits<double>::epsilon() * 0.5;
+
+  double v{0.0};     ///< computed value
+  double err{0.0};   ///< bound on |v - exact value|, first order
+
+  constexpr Checked() noexcept = default;
+  constexpr Checked(double value) noexcept : v(value) {}   // NOLINT: implicit by design
+  constexpr Checked(double value, double bound) noexcept : v(value), err(bound) {}
+
+  /// err / |v| (infinite for a zero value with nonzero error)
+  [[nodiscard]] double relative_error() const noexcept {
+    if (err == 0.0) return 0.0;
+    return v != 0.0 ? err / std::abs(v) : std::numeric_limits<double>::infinity();
+  }
+  [[nodiscard]] bool finite() const noexcept { return std::isfinite(v); }
+
+  /// Result of op: adds the rounding of `value` to the propagated bound and
+  /// reports it if finite operands gave a non-finite value
+  [[nodiscard]] static Checked result(FpOp op, double lhs, double rhs, double value,
+                                      double propagated) noexcept {
+    if (!std::isfinite(value) && std::isfinite(lhs) && std::isfinite(rhs)) {
+      FpEvent e;
+      e.op = op;
+      e.lhs = lhs;
+      e.rhs = rhs;
+      e.result = value;
+      fp_report(e);
+    }
+    return Checked{value, propagated + kUnit * std::abs(value)};
+  }
+
+  // ─────────────────────────────────────────────────────────────
+  // Arithmetic operators
+  // ─────────────────────────────────────────────────────────────
+  [[nodiscard]] Checked operator-() const noexcept { return Checked{-v, err}; }
+
+  [[nodiscard]] friend Checked operator+(const Checked& a, const Checked& b) noexcept {
+    return result(FpOp::add, a.v, b.v, a.v + b.v, a.err + b.err);
+  }
+  [[nodiscard]] friend Checked operator-(const Checked& a, const Checked& b) noexcept {
+    return result(FpOp::sub, a.v, b.v, a.v - b.v, a.err + b.err);
+  }
+  [[nodiscard]] friend Checked operator*(const Checked& a, const Checked& b) noexcept {
+    return result(FpOp::mul, a.v, b.v, a.v * b.v,
+                  std::abs(a.v) * b.err + std::abs(b.v) * a.err + a.err * b.err);
+  }
+  [[nodiscard]] friend Checked operator/(const Checked& a, const Checked& b) noexcept {
+    const double q = a.v / b.v;
+    // |a/b - (a+ea)/(b+eb)| <= (ea + |q| eb) / (|b| - eb)
+    const double margin = std::abs(b.v) - b.err;
+    const double propagated = margin > 0.0 ? (a.err + std::abs(q) * b.err) / margin
+                                           : std::numeric_limits<double>::infinity();
+    return result(FpOp::div, a.v, b.v, q, a.err == 0.0 && b.err == 0.0 ? 0.0 : propagated);
+  }
+
+  Checked& operator+=(const Checked& o) noexcept { return *this = *this + o; }
+  Checked& operator-=(const Checked& o) noexcept { return *this = *this - o; }
+  Checked& operator*=(const Checked& o) noexcept { return *this = *this * o; }
+  Checked& operator/=(const Checked& o) noexcept { return *this = *this / o; }
+
+  // ─────────────────────────────────────────────────────────────
+  // Comparison (value only)
+  // ─────────────────────────────────────────────────────────────
+  [[nodiscard]] friend constexpr bool operator==(const Checked& a, const Checked& b) noexcept {
+    return a.v == b.v;
+  }
+  [[nodiscard]] friend constexpr std::partial_ordering operator<=>(const Checked& a,
+                                                                   const Checked& b) noexcept {
+    return a.v <=> b.v;
+  }
+};
+
+template<>
+struct is_number_like<Checked> : std::true_type {};
+
+// ─────────────────────────────────────────────────────────────
+// Elementary functions (found by ADL: using std::sqrt; sqrt(x))
+// ─────────────────────────────────────────────────────────────
+// Library functions are taken as accurate to one unit roundoff on top of
+// the result rounding, and the input error is propagated by the slope
+
+[[nodiscard]] inline Checked sqrt(const Checked& a) noexcept {
+  const double s = std::sqrt(a.v);
+  const double slope = s > 0.0 ? 0.5 / s : std::numeric_limits<double>::infinity();
+  return Checked::result(FpOp::sqrt, a.v, 0.0, s, a.err == 0.0 ? 0.0 : slope * a.err);
+}
+
+[[nodiscard]] inline Checked sin(const Checked& a) noexcept {
+  const double s = std::sin(a.v);
+  return Checked::result(FpOp::sin, a.v, 0.0, s, a.err + Checked::kUnit * std::abs(s));
+}
+
+[[nodiscard]] inline Checked cos(const Checked& a) noexcept {
+  const double c = std::cos(a.v);
+  return Checked::result(FpOp::cos, a.v, 0.0, c, a.err + Checked::kUnit * std::abs(c));
+}
+
+[[nodiscard]] inline Checked exp(const Checked& a) noexcept {
+  const double e = std::exp(a.v);
+  return Checked::result(FpOp::exp, a.v, 0.0, e, e * a.err + Checked::kUnit * e);
+}
+
+[[nodiscard]] inline Checked log(const Checked& a) noexcept {
+  const double l = std::log(a.v);
+  return Checked::result(FpOp::log, a.v, 0.0, l,
+                         a.err / std::abs(a.v) + Checked::kUnit * std::abs(l));
+}
+
+[[nodiscard]] inline Checked abs(const Checked& a) noexcept {
+  return Checked{std::abs(a.v), a.err};
+}
+
+/// a^p for a constant exponent
+[[nodiscard]] inline Checked pow(const Checked& a, double p) noexcept {
+  const double r = std::pow(a.v, p);
+  const double slope = std::abs(p * std::pow(a.v, p - 1.0));
+  return Checked::result(FpOp::pow, a.v, p, r,
+                         (a.err == 0.0 ? 0.0 : slope * a.err) + Checked::kUnit * std::abs(r));
+}
+
+using CheckedVec2 = BasicVec2<Checked>;
+
+/// Checked in validation builds, double otherwise
+using ValidationReal = std::conditional_t<kFpValidation, Checked, double>;
+using ValidationVec2 = BasicVec2<ValidationReal>;
+
+} // namespace sim
+
+#endif // SIM_FP_VALIDATION_HPP
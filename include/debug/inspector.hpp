@@ -0,0 +1,215 @@
+#pragma once
+#ifndef SIM_INSPECTOR_HPP
+#define SIM_INSPECTOR_HPP
+// include/debug/inspector.hpp
+// Data side of the world inspector: what the simulation captures for the
+// UI, gated on which panels are open
+//
+// Design notes:
+//  - The UI thread stores the set of open panels in one atomic word. The
+//    simulation checks it with a relaxed load; with every panel closed
+//    each capture call is that load and a branch, and no clock is read
+//  - Captured rows go into the write slot of a PublishedState, so the
+//    simulation never blocks on the UI and the UI never sees a torn frame
+//  - Rows are plain copies (no pointers into the world), so the UI can
+//    keep showing a snapshot while the world changes or shrinks
+//  - Timing history lives on the reader side: the simulation only
+//    publishes the last step's phase times
+
+#include "../core/published_state.hpp"
+#include "../dynamics/contact_solver.hpp"
+#include "../dynamics/rigid_body.hpp"
+#include <algorithm>  // std::min
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+/// Bit flags for inspector panels
+enum InspectorPanel : std::uint32_t {
+  kPanelNone = 0,
+  kPanelBodies = 1u << 0,    ///< body list and per-body state
+  kPanelContacts = 1u << 1,
+  kPanelTimings = 1u << 2,
+};
+
+inline constexpr int kMaxInspectorPhases = 8;
+
+struct BodyRow {
+  std::uint32_t index{0};
+  Vec2 position{};
+  double angle{0.0};
+  Vec2 linear_velocity{};
+  double angular_velocity{0.0};
+  double inv_mass{0.0};
+  MaterialId material{kDefaultMaterial};
+};
+
+struct ContactRow {
+  int body_a{0};
+  int body_b{0};
+  Vec2 normal{};
+  int points{0};
+  double normal_impulse{0.0};    ///< summed over the manifold
+  double tangent_impulse{0.0};
+  double min_separation{0.0};
+};
+
+/// One published snapshot
+struct InspectorFrame {
+  std::uint64_t step{0};
+  std::uint32_t panels{kPanelNone};   ///< what was captured into this frame
+  std::vector<BodyRow> bodies;
+  std::vector<ContactRow> contacts;
+  std::array<const char*, kMaxInspectorPhases> phase_names{};
+  std::array<double, kMaxInspectorPhases> phase_ms{};
+  int phase_count{0};
+};
+
+// -----------------------------
+// Inspector Capture
+// -----------------------------
+class InspectorCapture {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /// UI thread: report which panels are open (InspectorPanel bits)
+  void set_open_panels(std::uint32_t panels) noexcept {
+    open_.store(panels, std::memory_order_relaxed);
+  }
+
+  /// Sim thread: call once at the start of a step
+  void begin_step() noexcept {
+    panels_ = open_.load(std::memory_order_relaxed);
+    if (panels_ == kPanelNone) return;
+    InspectorFrame& f = state_.write_buffer();
+    f.panels = panels_;
+    f.bodies.clear();
+    f.contacts.clear();
+    f.phase_count = 0;
+  }
+
+  [[nodiscard]] bool capturing(std::uint32_t panel) const noexcept { return (panels_ & panel) != 0; }
+
+  /// Sim thread: start timing a phase (no-op unless the timings panel is open)
+  void begin_phase(const char* name) noexcept {
+    if (!capturing(kPanelTimings)) return;
+    InspectorFrame& f = state_.write_buffer();
+    if (f.phase_count >= kMaxInspectorPhases) return;
+    f.phase_names[f.phase_count] = name;
+    phase_start_ = Clock::now();
+  }
+
+  void end_phase() noexcept {
+    if (!capturing(kPanelTimings)) return;
+    InspectorFrame& f = state_.write_buffer();
+    if (f.phase_count >= kMaxInspectorPhases) return;
+    f.phase_ms[f.phase_count++] =
+      std::chrono::duration<double, std::milli>(Clock::now() - phase_start_).count();
+  }
+
+  void capture_bodies(std::span<const RigidBody> bodies) {
+    if (!capturing(kPanelBodies)) return;
+    std::vector<BodyRow>& rows = state_.write_buffer().bodies;
+    rows.resize(bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      const RigidBody& b = bodies[i];
+      rows[i] = BodyRow{static_cast<std::uint32_t>(i), b.position, b.angle, b.linear_velocity,
+                        b.angular_velocity, b.inv_mass, b.material};
+    }
+  }
+
+  void capture_contacts(std::span<const ContactConstraint> constraints) {
+    if (!capturing(kPanelContacts)) return;
+    std::vector<ContactRow>& rows = state_.write_buffer().contacts;
+    rows.resize(constraints.size());
+    for (std::size_t i = 0; i < constraints.size(); ++i) {
+      const ContactConstraint& c = constraints[i];
+      ContactRow& r = rows[i];
+      r = ContactRow{c.body_a, c.body_b, c.normal, c.count, 0.0, 0.0, 0.0};
+      for (int k = 0; k < c.count; ++k) {
+        r.normal_impulse += c.points[k].normal_impulse;
+        r.tangent_impulse += c.points[k].tangent_impulse;
+        r.min_separation = k == 0 ? c.points[k].separation
+                                  : std::min(r.min_separation, c.points[k].separation);
+      }
+    }
+  }
+
+  /// Sim thread: call once at the end of a step
+  void end_step(std::uint64_t step) noexcept {
+    if (panels_ == kPanelNone) return;
+    state_.write_buffer().step = step;
+    state_.publish();
+  }
+
+  /// UI thread: newest frame, if one arrived since the last call
+  bool acquire() noexcept { return state_.acquire(); }
+  [[nodiscard]] const InspectorFrame& frame() const noexcept { return state_.read_buffer(); }
+
+private:
+  std::atomic<std::uint32_t> open_{kPanelNone};
+  std::uint32_t panels_{kPanelNone};     ///< sim thread's copy for this step
+  Clock::time_point phase_start_{};
+  PublishedState<InspectorFrame> state_;
+};
+
+/// RAII phase timer for InspectorCapture
+class InspectorPhase {
+public:
+  InspectorPhase(InspectorCapture& capture, const char* name) noexcept : capture_(capture) {
+    capture_.begin_phase(name);
+  }
+  ~InspectorPhase() { capture_.end_phase(); }
+  InspectorPhase(const InspectorPhase&) = delete;
+  InspectorPhase& operator=(const InspectorPhase&) = delete;
+
+private:
+  InspectorCapture& capture_;
+};
+
+// -----------------------------
+// Timing History
+// -----------------------------
+/// Reader-side ring of per-phase times, laid out for line plots
+template<std::size_t N = 240>
+class TimingHistory {
+public:
+  void push(const InspectorFrame& f) noexcept {
+    if ((f.panels & kPanelTimings) == 0) return;
+    phase_count_ = f.phase_count;
+    for (int p = 0; p < f.phase_count; ++p) {
+      names_[p] = f.phase_names[p];
+      samples_[p][head_] = static_cast<float>(f.phase_ms[p]);
+    }
+    head_ = (head_ + 1) % N;
+    if (size_ < N) ++size_;
+  }
+
+  /// Samples of phase p, oldest first starting at offset()
+  [[nodiscard]] const float* samples(int p) const noexcept { return samples_[p].data(); }
+  [[nodiscard]] int offset() const noexcept { return size_ < N ? 0 : static_cast<int>(head_); }
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+  [[nodiscard]] static constexpr std::size_t capacity() noexcept { return N; }
+  [[nodiscard]] int phase_count() const noexcept { return phase_count_; }
+  [[nodiscard]] const char* name(int p) const noexcept { return names_[p]; }
+
+  /// Most recent sample of phase p
+  [[nodiscard]] float latest(int p) const noexcept { return samples_[p][(head_ + N - 1) % N]; }
+
+private:
+  std::array<std::array<float, N>, kMaxInspectorPhases> samples_{};
+  std::array<const char*, kMaxInspectorPhases> names_{};
+  std::size_t head_{0};
+  std::size_t size_{0};
+  int phase_count_{0};
+};
+
+} // namespace sim
+
+#endif // SIM_INSPECTOR_HPP
@@ -0,0 +1,254 @@
+#pragma once
+#ifndef SIM_ARTICULATION_HPP
+#define SIM_ARTICULATION_HPP
+// include/dynamics/articulation.hpp
+// Reduced-coordinate articulated bodies (planar Featherstone ABA)
+//
+// Design notes:
+//  - A tree of links hanging off a fixed base; each link has one
+//    degree of freedom (revolute or prismatic) relative to its parent
+//  - State is the joint coordinates q/qd, so joints cannot drift apart
+//    and long chains need no solver iterations: the articulated-body
+//    algorithm gives exact joint accelerations in O(n)
+//  - Planar spatial vectors are Vec3 (angular, x, y); motion and force
+//    vectors share the type and are told apart by the operators used
+//  - Links must be added parent-first (parent index < link index)
+
+#include "../math/mat33.hpp"
+#include "../math/transform2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+enum class ArticulationJoint : std::uint8_t { revolute, prismatic };
+
+// -----------------------------
+// Link Definition
+// -----------------------------
+struct ArticulationLinkDef {
+  int parent{-1};                    ///< -1 attaches the link to the base
+  ArticulationJoint joint{ArticulationJoint::revolute};
+  Vec2 joint_offset{};               ///< joint position in the parent frame
+  double joint_angle_offset{0.0};    ///< rest rotation of the joint frame
+  Vec2 axis{1.0, 0.0};               ///< prismatic slide axis (joint frame)
+  double mass{1.0};
+  Vec2 center_of_mass{};             ///< in the link frame
+  double inertia{0.0};               ///< rotational inertia about the COM
+  double damping{0.0};               ///< viscous joint damping
+  double q{0.0};                     ///< initial joint position
+  double qd{0.0};                    ///< initial joint velocity
+};
+
+namespace detail {
+
+/// Planar motion cross product v x m
+[[nodiscard]] constexpr Vec3 cross_motion(const Vec3& v, const Vec3& m) noexcept {
+  return Vec3{0.0, v.z * m.x - v.x * m.z, -v.y * m.x + v.x * m.y};
+}
+
+/// Planar force cross product v x* f
+[[nodiscard]] constexpr Vec3 cross_force(const Vec3& v, const Vec3& f) noexcept {
+  return Vec3{v.y * f.z - v.z * f.y, -v.x * f.z, v.x * f.y};
+}
+
+/// Motion transform from a parent frame into a child frame placed at r
+/// with relative rotation q (both expressed in the parent frame)
+[[nodiscard]] constexpr Mat33 motion_transform(const Rot2& q, const Vec2& r) noexcept {
+  const Vec2 moment = q.inv_apply(r.perpendicular());
+  return Mat33{Vec3{1.0, moment}, Vec3{0.0, q.c, -q.s}, Vec3{0.0, q.s, q.c}};
+}
+
+/// Spatial inertia about the link origin
+[[nodiscard]] constexpr Mat33 spatial_inertia(double m, const Vec2& c, double ic) noexcept {
+  return Mat33{Vec3{ic + m * c.length_sq(), -m * c.y, m * c.x},
+               Vec3{-m * c.y, m, 0.0},
+               Vec3{m * c.x, 0.0, m}};
+}
+
+} // namespace detail
+
+// -----------------------------
+// Articulation
+// -----------------------------
+class Articulation {
+public:
+  explicit Articulation(const Transform2& base = Transform2{}) : base_(base) {}
+
+  /// Append a link; returns its index
+  int add_link(const ArticulationLinkDef& def) {
+    const int index = static_cast<int>(parent_.size());
+    parent_.push_back(def.parent < index ? def.parent : -1);
+    joint_.push_back(def.joint);
+    offset_.push_back(def.joint_offset);
+    offset_rot_.push_back(Rot2::from_angle(def.joint_angle_offset));
+    axis_.push_back(def.axis.normalized());
+    mass_.push_back(def.mass);
+    com_.push_back(def.center_of_mass);
+    inertia_.push_back(spatial_inertia_for(def));
+    damping_.push_back(def.damping);
+    q.push_back(def.q);
+    qd.push_back(def.qd);
+    qdd.push_back(0.0);
+    tau.push_back(0.0);
+
+    X_.emplace_back();
+    S_.emplace_back();
+    v_.emplace_back();
+    c_.emplace_back();
+    a_.emplace_back();
+    IA_.emplace_back();
+    pA_.emplace_back();
+    U_.emplace_back();
+    D_.push_back(0.0);
+    u_.push_back(0.0);
+    f_ext_.emplace_back();
+    world_.emplace_back();
+    return index;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return parent_.size(); }
+  [[nodiscard]] int parent(int link) const noexcept { return parent_[link]; }
+  [[nodiscard]] const Transform2& base() const noexcept { return base_; }
+
+  /// Link frame in world space, valid after update_kinematics() or a step
+  [[nodiscard]] const Transform2& link_transform(int link) const noexcept { return world_[link]; }
+
+  /// World-space centre of mass of a link
+  [[nodiscard]] Vec2 link_center(int link) const noexcept { return world_[link].apply(com_[link]); }
+
+  /// Add a world-space force at a world-space point for the next step
+  void apply_force(int link, const Vec2& force, const Vec2& point) noexcept {
+    const Transform2& xf = world_[link];
+    const Vec2 f = xf.q.inv_apply(force);
+    const Vec2 p = xf.inv_apply(point);
+    f_ext_[link] += Vec3{p.cross(f), f};
+  }
+
+  /// Recompute link frames from q without touching velocities
+  void update_kinematics() {
+    for (std::size_t i = 0; i < size(); ++i) {
+      const Transform2 local = local_transform(i);
+      world_[i] = parent_[i] < 0 ? base_ * local : world_[parent_[i]] * local;
+    }
+  }
+
+  /// Featherstone articulated-body algorithm: fills qdd from q, qd, tau
+  void compute_forward_dynamics(const Vec2& gravity) {
+    const std::size_t n = size();
+    // Gravity enters as a fictitious upward acceleration of the base
+    const Vec3 a0{0.0, -base_.q.inv_apply(gravity)};
+
+    // Pass 1 (root to leaves): velocities, bias terms, link inertias
+    for (std::size_t i = 0; i < n; ++i) {
+      const Transform2 local = local_transform(i);
+      const int p = parent_[i];
+      world_[i] = p < 0 ? base_ * local : world_[p] * local;
+
+      X_[i] = detail::motion_transform(local.q, local.p);
+      S_[i] = joint_[i] == ArticulationJoint::revolute ? Vec3{1.0, 0.0, 0.0}
+                                                      : Vec3{0.0, axis_[i]};
+      const Vec3 vj = S_[i] * qd[i];
+      v_[i] = (p < 0 ? Vec3{} : X_[i] * v_[p]) + vj;
+      c_[i] = detail::cross_motion(v_[i], vj);
+      IA_[i] = inertia_[i];
+      pA_[i] = detail::cross_force(v_[i], inertia_[i] * v_[i]) - f_ext_[i];
+    }
+
+    // Pass 2 (leaves to root): articulated inertias and bias forces
+    for (std::size_t k = n; k-- > 0;) {
+      U_[k] = IA_[k] * S_[k];
+      D_[k] = S_[k].dot(U_[k]);
+      u_[k] = tau[k] - damping_[k] * qd[k] - S_[k].dot(pA_[k]);
+
+      const int p = parent_[k];
+      if (p < 0 || D_[k] <= 0.0) continue;
+
+      const Mat33 Ia = IA_[k] - Mat33::outer(U_[k], U_[k] * (1.0 / D_[k]));
+      const Vec3 pa = pA_[k] + Ia * c_[k] + U_[k] * (u_[k] / D_[k]);
+      const Mat33 Xt = X_[k].transposed();
+      IA_[p] = IA_[p] + Xt * Ia * X_[k];
+      pA_[p] += Xt * pa;
+    }
+
+    // Pass 3 (root to leaves): accelerations
+    for (std::size_t i = 0; i < n; ++i) {
+      const int p = parent_[i];
+      a_[i] = X_[i] * (p < 0 ? a0 : a_[p]) + c_[i];
+      qdd[i] = D_[i] > 0.0 ? (u_[i] - U_[i].dot(a_[i])) / D_[i] : 0.0;
+      a_[i] += S_[i] * qdd[i];
+    }
+
+    for (Vec3& f : f_ext_) f = Vec3{};
+  }
+
+  /// Forward dynamics + semi-implicit Euler on the joint coordinates
+  void step(double dt, const Vec2& gravity) {
+    compute_forward_dynamics(gravity);
+    for (std::size_t i = 0; i < size(); ++i) {
+      qd[i] += qdd[i] * dt;
+      q[i] += qd[i] * dt;
+    }
+    update_kinematics();
+  }
+
+  /// Total kinetic energy (uses velocities from the last dynamics pass)
+  [[nodiscard]] double kinetic_energy() const noexcept {
+    double e = 0.0;
+    for (std::size_t i = 0; i < size(); ++i) e += 0.5 * v_[i].dot(inertia_[i] * v_[i]);
+    return e;
+  }
+
+  /// Gravitational potential energy relative to the world origin
+  [[nodiscard]] double potential_energy(const Vec2& gravity) const noexcept {
+    double e = 0.0;
+    for (std::size_t i = 0; i < size(); ++i) e -= mass_[i] * gravity.dot(link_center(static_cast<int>(i)));
+    return e;
+  }
+
+  // Joint-space state, one entry per link
+  std::vector<double> q;     ///< joint position (radians or length)
+  std::vector<double> qd;    ///< joint velocity
+  std::vector<double> qdd;   ///< joint acceleration from the last dynamics pass
+  std::vector<double> tau;   ///< applied joint torque/force
+
+private:
+  [[nodiscard]] static Mat33 spatial_inertia_for(const ArticulationLinkDef& def) noexcept {
+    return detail::spatial_inertia(def.mass, def.center_of_mass, def.inertia);
+  }
+
+  /// Link frame relative to its parent (or the base) for the current q
+  [[nodiscard]] Transform2 local_transform(std::size_t i) const noexcept {
+    if (joint_[i] == ArticulationJoint::revolute) {
+      return Transform2{offset_[i], offset_rot_[i] * Rot2::from_angle(q[i])};
+    }
+    return Transform2{offset_[i] + offset_rot_[i].apply(axis_[i] * q[i]), offset_rot_[i]};
+  }
+
+  Transform2 base_;
+
+  // Link model
+  std::vector<int> parent_;
+  std::vector<ArticulationJoint> joint_;
+  std::vector<Vec2> offset_;
+  std::vector<Rot2> offset_rot_;
+  std::vector<Vec2> axis_;
+  std::vector<double> mass_;
+  std::vector<Vec2> com_;
+  std::vector<Mat33> inertia_;
+  std::vector<double> damping_;
+
+  // ABA scratch
+  std::vector<Mat33> X_;
+  std::vector<Vec3> S_, v_, c_, a_;
+  std::vector<Mat33> IA_;
+  std::vector<Vec3> pA_, U_;
+  std::vector<double> D_, u_;
+  std::vector<Vec3> f_ext_;
+  std::vector<Transform2> world_;
+};
+
+} // namespace sim
+
+#endif // SIM_ARTICULATION_HPP
@@ -0,0 +1,222 @@
+#pragma once
+#ifndef SIM_CONTACT_SOLVER_HPP
+#define SIM_CONTACT_SOLVER_HPP
+// include/dynamics/contact_solver.hpp
+// Sequential-impulse contact solver with friction, restitution and
+// rolling resistance
+//
+// Design notes:
+//  - Coefficients are fetched from the MaterialTable once, when the
+//    constraint is added; the iterations only read plain doubles
+//  - Restitution uses the approach speed measured in prepare(), before
+//    any impulse, and is skipped below restitution_threshold so resting
+//    contacts do not jitter
+//  - Rolling resistance is an angular impulse bounded by
+//    rolling_resistance * rolling_radius * normal impulse
+
+#include "material.hpp"
+#include "rigid_body.hpp"
+#include "../collision/manifold.hpp"
+#include <algorithm>  // std::clamp, std::max, std::min
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+struct ContactSolverSettings {
+  double baumgarte{0.2};              ///< fraction of penetration removed per step
+  double max_bias_velocity{4.0};      ///< clamp on the Baumgarte push-out speed
+  double restitution_threshold{1.0};  ///< approach speed below which contacts don't bounce
+  bool warm_starting{true};
+};
+
+// -----------------------------
+// Contact Constraint
+// -----------------------------
+struct ContactConstraintPoint {
+  Vec2 ra{};                  ///< anchor relative to A's centre of mass
+  Vec2 rb{};
+  double separation{0.0};
+  double normal_mass{0.0};
+  double tangent_mass{0.0};
+  double normal_impulse{0.0}; ///< accumulated
+  double tangent_impulse{0.0};
+  double velocity_bias{0.0};
+  std::uint32_t id{0};
+};
+
+struct ContactConstraint {
+  int body_a{0};
+  int body_b{0};
+  Vec2 normal{};              ///< from A to B
+  double friction{0.0};
+  double restitution{0.0};
+  double rolling_resistance{0.0};  ///< already scaled by the rolling radius
+  double rolling_mass{0.0};
+  double rolling_impulse{0.0};
+  std::array<ContactConstraintPoint, kMaxManifoldPoints> points{};
+  int count{0};
+};
+
+// -----------------------------
+// Contact Solver
+// -----------------------------
+class ContactSolver {
+public:
+  void clear() noexcept { constraints_.clear(); }
+
+  /// Add a manifold between bodies a and b. rolling_radius is the radius
+  /// of the rolling shape (0 disables rolling resistance).
+  ContactConstraint& add(int a, int b, const Manifold& m, std::span<const RigidBody> bodies,
+                         const MaterialTable& materials, double rolling_radius = 0.0) {
+    const MaterialPair& mp = materials.pair(bodies[a].material, bodies[b].material);
+    ContactConstraint& c = constraints_.emplace_back();
+    c.body_a = a;
+    c.body_b = b;
+    c.normal = m.normal;
+    c.friction = mp.friction;
+    c.restitution = mp.restitution;
+    c.rolling_resistance = mp.rolling_resistance * rolling_radius;
+    c.count = m.count;
+    for (int i = 0; i < m.count; ++i) {
+      c.points[i].ra = m.points[i].point - bodies[a].position;
+      c.points[i].rb = m.points[i].point - bodies[b].position;
+      c.points[i].separation = m.points[i].separation;
+      c.points[i].id = m.points[i].id;
+    }
+    return c;
+  }
+
+  /// Carry accumulated impulses over from last step's constraint for the
+  /// same pair, matching points by feature id
+  static void match_impulses(ContactConstraint& c, const ContactConstraint& previous) noexcept {
+    for (int i = 0; i < c.count; ++i) {
+      for (int j = 0; j < previous.count; ++j) {
+        if (c.points[i].id != previous.points[j].id) continue;
+        c.points[i].normal_impulse = previous.points[j].normal_impulse;
+        c.points[i].tangent_impulse = previous.points[j].tangent_impulse;
+      }
+    }
+    c.rolling_impulse = previous.rolling_impulse;
+  }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const ContactSolverSettings& s) {
+    const double inv_dt = dt > 0.0 ? 1.0 / dt : 0.0;
+    for (ContactConstraint& c : constraints_) {
+      const RigidBody& a = bodies[c.body_a];
+      const RigidBody& b = bodies[c.body_b];
+      const double k_inertia = a.inv_inertia + b.inv_inertia;
+      c.rolling_mass = k_inertia > 0.0 ? 1.0 / k_inertia : 0.0;
+      if (!s.warm_starting) c.rolling_impulse = 0.0;
+
+      const Vec2 tangent = c.normal.perpendicular();
+      for (int i = 0; i < c.count; ++i) {
+        ContactConstraintPoint& p = c.points[i];
+        const double rna = p.ra.cross(c.normal);
+        const double rnb = p.rb.cross(c.normal);
+        const double kn = a.inv_mass + b.inv_mass + a.inv_inertia * rna * rna + b.inv_inertia * rnb * rnb;
+        p.normal_mass = kn > 0.0 ? 1.0 / kn : 0.0;
+
+        const double rta = p.ra.cross(tangent);
+        const double rtb = p.rb.cross(tangent);
+        const double kt = a.inv_mass + b.inv_mass + a.inv_inertia * rta * rta + b.inv_inertia * rtb * rtb;
+        p.tangent_mass = kt > 0.0 ? 1.0 / kt : 0.0;
+
+        if (!s.warm_starting) {
+          p.normal_impulse = 0.0;
+          p.tangent_impulse = 0.0;
+        }
+
+        const double vn = (b.velocity_at(p.rb) - a.velocity_at(p.ra)).dot(c.normal);
+        const double bounce = vn < -s.restitution_threshold ? -c.restitution * vn : 0.0;
+        const double push = std::min(s.baumgarte * inv_dt * std::max(0.0, -(p.separation + kLinearSlop)),
+                                     s.max_bias_velocity);
+        p.velocity_bias = std::max(bounce, push);
+      }
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (const ContactConstraint& c : constraints_) {
+      RigidBody& a = bodies[c.body_a];
+      RigidBody& b = bodies[c.body_b];
+      const Vec2 tangent = c.normal.perpendicular();
+      a.angular_velocity -= a.inv_inertia * c.rolling_impulse;
+      b.angular_velocity += b.inv_inertia * c.rolling_impulse;
+      for (int i = 0; i < c.count; ++i) {
+        const ContactConstraintPoint& p = c.points[i];
+        apply(a, b, p, c.normal * p.normal_impulse + tangent * p.tangent_impulse);
+      }
+    }
+  }
+
+  /// One velocity iteration over all constraints
+  void solve_velocities(std::span<RigidBody> bodies) {
+    for (ContactConstraint& c : constraints_) {
+      RigidBody& a = bodies[c.body_a];
+      RigidBody& b = bodies[c.body_b];
+      const Vec2 tangent = c.normal.perpendicular();
+
+      // Normal first so friction sees this iteration's normal impulse
+      double total_normal = 0.0;
+      for (int i = 0; i < c.count; ++i) {
+        ContactConstraintPoint& p = c.points[i];
+        const double vn = (b.velocity_at(p.rb) - a.velocity_at(p.ra)).dot(c.normal);
+        const double lambda = -p.normal_mass * (vn - p.velocity_bias);
+        const double next = std::max(p.normal_impulse + lambda, 0.0);
+        apply(a, b, p, c.normal * (next - p.normal_impulse));
+        p.normal_impulse = next;
+        total_normal += next;
+      }
+
+      for (int i = 0; i < c.count; ++i) {
+        ContactConstraintPoint& p = c.points[i];
+        const double vt = (b.velocity_at(p.rb) - a.velocity_at(p.ra)).dot(tangent);
+        const double limit = c.friction * p.normal_impulse;
+        const double next = std::clamp(p.tangent_impulse - p.tangent_mass * vt, -limit, limit);
+        apply(a, b, p, tangent * (next - p.tangent_impulse));
+        p.tangent_impulse = next;
+      }
+
+      if (c.rolling_resistance > 0.0) {
+        const double limit = c.rolling_resistance * total_normal;
+        const double dw = b.angular_velocity - a.angular_velocity;
+        const double next = std::clamp(c.rolling_impulse - c.rolling_mass * dw, -limit, limit);
+        const double delta = next - c.rolling_impulse;
+        c.rolling_impulse = next;
+        a.angular_velocity -= a.inv_inertia * delta;
+        b.angular_velocity += b.inv_inertia * delta;
+      }
+    }
+  }
+
+  /// prepare + warm start + iterations
+  void solve(std::span<RigidBody> bodies, double dt, int iterations,
+             const ContactSolverSettings& settings = {}) {
+    prepare(bodies, dt, settings);
+    if (settings.warm_starting) warm_start(bodies);
+    for (int it = 0; it < iterations; ++it) solve_velocities(bodies);
+  }
+
+  [[nodiscard]] std::span<ContactConstraint> constraints() noexcept { return constraints_; }
+  [[nodiscard]] std::span<const ContactConstraint> constraints() const noexcept { return constraints_; }
+  [[nodiscard]] std::size_t size() const noexcept { return constraints_.size(); }
+
+private:
+  static void apply(RigidBody& a, RigidBody& b, const ContactConstraintPoint& p,
+                    const Vec2& impulse) noexcept {
+    a.linear_velocity -= impulse * a.inv_mass;
+    a.angular_velocity -= a.inv_inertia * p.ra.cross(impulse);
+    b.linear_velocity += impulse * b.inv_mass;
+    b.angular_velocity += b.inv_inertia * p.rb.cross(impulse);
+  }
+
+  std::vector<ContactConstraint> constraints_;
+};
+
+} // namespace sim
+
+#endif // SIM_CONTACT_SOLVER_HPP
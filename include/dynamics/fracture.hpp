@@ -0,0 +1,323 @@
+#pragma once
+#ifndef SIM_FRACTURE_HPP
+#define SIM_FRACTURE_HPP
+// include/dynamics/fracture.hpp
+// Breakable bodies: Voronoi shatter patterns built ahead of time and
+// instanced as pooled debris when a body breaks
+//
+// Design notes:
+//  - Clipping cells is the expensive part, so it happens when a pattern
+//    is built (at load time or in a tool), never at break time. Breaking
+//    copies the pattern's pieces and maps them through the body transform
+//  - Pieces are stored relative to their own centroid, with area and
+//    unit-density inertia baked in, so a debris body is ready to
+//    simulate as soon as it is copied
+//  - Debris lives in a Pool: repeated breaks reuse slots freed by expired
+//    pieces, and a live-piece budget retires the oldest debris first
+//  - Voronoi cells of a convex shape are convex, but may have more than
+//    kMaxPolygonVertices corners; the least significant corners are
+//    dropped, which shrinks the cell slightly but keeps it convex
+
+#include "contact_solver.hpp"
+#include "rigid_body.hpp"
+#include "../collision/polygon.hpp"
+#include "../core/pool.hpp"
+#include "../core/xorshift.hpp"
+#include <algorithm>  // std::max, std::min
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+/// One precomputed fragment of a shatter pattern
+struct ShatterPiece {
+  Polygon shape{};          ///< relative to the piece's centroid
+  Vec2 offset{};            ///< piece centroid in the source shape's frame
+  double area{0.0};
+  double unit_inertia{0.0}; ///< about the centroid, at density 1
+};
+
+struct ShatterPattern {
+  std::vector<ShatterPiece> pieces;
+
+  [[nodiscard]] double area() const noexcept {
+    double a = 0.0;
+    for (const ShatterPiece& p : pieces) a += p.area;
+    return a;
+  }
+};
+
+namespace detail {
+
+/// Keep the part of a convex loop where dot(n, p) <= d (Sutherland-Hodgman)
+inline void clip_half_plane(std::vector<Vec2>& loop, std::vector<Vec2>& scratch,
+                            const Vec2& n, double d) {
+  scratch.clear();
+  const std::size_t count = loop.size();
+  for (std::size_t i = 0; i < count; ++i) {
+    const Vec2& a = loop[i];
+    const Vec2& b = loop[(i + 1) % count];
+    const double da = n.dot(a) - d;
+    const double db = n.dot(b) - d;
+    if (da <= 0.0) scratch.push_back(a);
+    if ((da < 0.0 && db > 0.0) || (da > 0.0 && db < 0.0)) scratch.push_back(a.lerp(b, da / (da - db)));
+  }
+  loop.swap(scratch);
+}
+
+/// Drop corners until the loop fits in a Polygon, removing the one whose
+/// triangle with its neighbours has the smallest area each time
+inline void reduce_loop(std::vector<Vec2>& loop) {
+  while (loop.size() > static_cast<std::size_t>(kMaxPolygonVertices)) {
+    const std::size_t n = loop.size();
+    std::size_t best = 0;
+    double best_area = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const Vec2& prev = loop[(i + n - 1) % n];
+      const Vec2& next = loop[(i + 1) % n];
+      const double a = (loop[i] - prev).cross(next - prev);
+      if (i == 0 || a < best_area) {
+        best_area = a;
+        best = i;
+      }
+    }
+    loop.erase(loop.begin() + static_cast<std::ptrdiff_t>(best));
+  }
+}
+
+[[nodiscard]] inline bool polygon_contains(const Polygon& poly, const Vec2& p) noexcept {
+  for (int i = 0; i < poly.count; ++i) {
+    if (poly.normals[i].dot(p - poly.vertices[i]) > 0.0) return false;
+  }
+  return poly.count >= 3;
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────
+// Pattern Building (offline)
+// ─────────────────────────────────────────────────────────────
+
+/// Deterministic Voronoi sites scattered inside a convex shape
+[[nodiscard]] inline std::vector<Vec2> make_shatter_sites(const Polygon& shape, int count,
+                                                          std::uint32_t seed = 1) {
+  std::vector<Vec2> sites;
+  if (shape.count < 3 || count <= 0) return sites;
+  Vec2 lo = shape.vertices[0];
+  Vec2 hi = shape.vertices[0];
+  for (int i = 1; i < shape.count; ++i) {
+    lo = Vec2{std::min(lo.x, shape.vertices[i].x), std::min(lo.y, shape.vertices[i].y)};
+    hi = Vec2{std::max(hi.x, shape.vertices[i].x), std::max(hi.y, shape.vertices[i].y)};
+  }
+  XorShift32 rng(seed);
+  sites.reserve(static_cast<std::size_t>(count));
+  for (int attempt = 0; static_cast<int>(sites.size()) < count && attempt < count * 64; ++attempt) {
+    const Vec2 p{rng.uniform(lo.x, hi.x), rng.uniform(lo.y, hi.y)};
+    if (detail::polygon_contains(shape, p)) sites.push_back(p);
+  }
+  return sites;
+}
+
+/// Split a convex shape into the Voronoi cells of the given sites.
+/// Cells smaller than min_area (slivers) are discarded.
+[[nodiscard]] inline ShatterPattern build_shatter_pattern(const Polygon& shape,
+                                                          std::span<const Vec2> sites,
+                                                          double min_area = 1e-9) {
+  ShatterPattern pattern;
+  pattern.pieces.reserve(sites.size());
+  std::vector<Vec2> loop;
+  std::vector<Vec2> scratch;
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    loop.assign(shape.vertices.begin(), shape.vertices.begin() + shape.count);
+    // Cell i is the shape minus everything closer to another site
+    for (std::size_t j = 0; j < sites.size() && loop.size() >= 3; ++j) {
+      if (j == i) continue;
+      const Vec2 n = sites[j] - sites[i];
+      if (n.length_sq() == 0.0) continue;
+      detail::clip_half_plane(loop, scratch, n, n.dot((sites[i] + sites[j]) * 0.5));
+    }
+    if (loop.size() < 3) continue;
+    detail::reduce_loop(loop);
+
+    const Polygon cell = make_polygon(loop);
+    const MassData md = compute_mass(cell, 1.0);
+    if (md.mass < min_area) continue;
+    for (Vec2& v : loop) v -= md.center;
+
+    ShatterPiece& piece = pattern.pieces.emplace_back();
+    piece.shape = make_polygon(loop);
+    piece.offset = md.center;
+    piece.area = md.mass;
+    piece.unit_inertia = md.inertia;
+  }
+  return pattern;
+}
+
+// -----------------------------
+// Shatter Library
+// -----------------------------
+using PatternId = std::uint32_t;
+
+/// Patterns keyed by the shape they were cut from. Built once at load
+/// time; breaking only reads from it.
+class ShatterLibrary {
+public:
+  PatternId add(ShatterPattern pattern) {
+    patterns_.push_back(std::move(pattern));
+    return static_cast<PatternId>(patterns_.size() - 1);
+  }
+
+  /// Cut shape with count seeded sites and store the result
+  PatternId add(const Polygon& shape, int count, std::uint32_t seed = 1) {
+    const std::vector<Vec2> sites = make_shatter_sites(shape, count, seed);
+    return add(build_shatter_pattern(shape, sites));
+  }
+
+  [[nodiscard]] const ShatterPattern& pattern(PatternId id) const noexcept { return patterns_[id]; }
+  [[nodiscard]] std::size_t size() const noexcept { return patterns_.size(); }
+
+private:
+  std::vector<ShatterPattern> patterns_;
+};
+
+/// Marks a body as breakable with the given pattern
+struct Breakable {
+  int body{0};
+  PatternId pattern{0};
+  double threshold{1.0};          ///< total normal impulse that breaks it
+};
+
+/// Total normal impulse the contact solver applied to body this step
+[[nodiscard]] inline double contact_impulse(std::span<const ContactConstraint> constraints,
+                                            int body) noexcept {
+  double total = 0.0;
+  for (const ContactConstraint& c : constraints) {
+    if (c.body_a != body && c.body_b != body) continue;
+    for (int i = 0; i < c.count; ++i) total += c.points[i].normal_impulse;
+  }
+  return total;
+}
+
+// -----------------------------
+// Debris System
+// -----------------------------
+struct DebrisConfig {
+  double density{1.0};
+  double lifetime{5.0};           ///< seconds before a piece is retired
+  std::size_t max_debris{512};    ///< live-piece budget; oldest go first
+  double burst_speed{0.0};        ///< extra speed away from the impact point
+};
+
+struct Debris {
+  RigidBody body{};
+  Polygon shape{};                ///< relative to body.position
+  double age{0.0};
+};
+
+class DebrisSystem {
+public:
+  using DebrisHandle = Handle<Debris>;
+
+  explicit DebrisSystem(const DebrisConfig& config = {}) : config_(config) {
+    pool_.reserve(config_.max_debris);
+  }
+
+  /// Replace source with the pieces of pattern. Every piece inherits the
+  /// velocity of its point on the source body, then receives an equal
+  /// share of impulse plus burst_speed away from impact_point. When the
+  /// debris budget truncates the pattern, impulse is shared among the
+  /// pieces actually spawned, so their momentum still gains all of it.
+  /// Returns the number of pieces spawned.
+  std::size_t shatter(const RigidBody& source, const ShatterPattern& pattern,
+                      const Vec2& impact_point, const Vec2& impulse = {}) {
+    spawned_.clear();
+    if (pattern.pieces.empty()) return 0;
+    const Transform2 xf = source.transform();
+    const std::size_t incoming = std::min(pattern.pieces.size(), config_.max_debris);
+    double spawned_area = 0.0;
+    for (std::size_t i = 0; i < incoming; ++i) spawned_area += pattern.pieces[i].area;
+    const Vec2 kick = impulse / (config_.density * spawned_area);
+
+    while (pool_.size() + incoming > config_.max_debris) retire_oldest();
+
+    for (std::size_t i = 0; i < incoming; ++i) {
+      const ShatterPiece& piece = pattern.pieces[i];
+      const Vec2 center = xf.apply(piece.offset);
+      const Vec2 r = center - source.position;
+
+      Debris d;
+      d.shape = piece.shape;
+      d.body.position = center;
+      d.body.angle = source.angle;
+      d.body.linear_velocity = source.velocity_at(r) + kick +
+                               (center - impact_point).normalized() * config_.burst_speed;
+      d.body.angular_velocity = source.angular_velocity;
+      d.body.inv_mass = 1.0 / (config_.density * piece.area);
+      d.body.inv_inertia = 1.0 / (config_.density * piece.unit_inertia);
+      d.body.material = source.material;
+
+      const DebrisHandle h = pool_.create(d);
+      order_.push_back(h);
+      spawned_.push_back(h);
+    }
+    return incoming;
+  }
+
+  /// shatter() with the burst centred on the source body
+  std::size_t shatter(const RigidBody& source, const ShatterPattern& pattern) {
+    return shatter(source, pattern, source.position);
+  }
+
+  /// Integrate live debris and retire pieces older than the lifetime
+  void step(const Vec2& gravity, double dt) {
+    pool_.for_each([&](DebrisHandle, Debris& d) {
+      d.body.linear_velocity += gravity * dt;
+      d.body.position += d.body.linear_velocity * dt;
+      d.body.angle += d.body.angular_velocity * dt;
+      d.age += dt;
+    });
+    // order_ is oldest first, so expired pieces sit at the front
+    while (!order_.empty()) {
+      const Debris* d = pool_.get(order_.front());
+      if (d != nullptr && d->age < config_.lifetime) break;
+      if (d != nullptr) pool_.destroy(order_.front());
+      order_.pop_front();
+    }
+  }
+
+  /// Remove one piece early (e.g. it fell out of the world)
+  bool destroy(DebrisHandle h) { return pool_.destroy(h); }
+
+  [[nodiscard]] Debris* get(DebrisHandle h) noexcept { return pool_.get(h); }
+
+  template<typename Fn>
+  void for_each(Fn&& fn) { pool_.for_each(std::forward<Fn>(fn)); }
+
+  /// Handles created by the last shatter() call
+  [[nodiscard]] std::span<const DebrisHandle> spawned() const noexcept { return spawned_; }
+  [[nodiscard]] std::size_t size() const noexcept { return pool_.size(); }
+  [[nodiscard]] const PoolStats& pool_stats() const noexcept { return pool_.stats(); }
+  [[nodiscard]] const DebrisConfig& config() const noexcept { return config_; }
+
+private:
+  void retire_oldest() {
+    while (!order_.empty()) {
+      const DebrisHandle h = order_.front();
+      order_.pop_front();
+      if (pool_.destroy(h)) return;
+    }
+  }
+
+  DebrisConfig config_;
+  Pool<Debris> pool_;
+  std::deque<DebrisHandle> order_;
+  std::vector<DebrisHandle> spawned_;
+};
+
+} // namespace sim
+
+#endif // SIM_FRACTURE_HPP
@@ -0,0 +1,977 @@
+#pragma once
+#ifndef SIM_JOINTS_HPP
+#define SIM_JOINTS_HPP
+// include/dynamics/joints.hpp
+// Rigid body joints: revolute, prismatic, weld, distance, rope, motor
+//
+// Design notes:
+//  - One SoA batch per joint type. The solver walks each batch in a
+//    tight, type-homogeneous loop: no virtual dispatch, no per-joint
+//    branching on type, and every column is a contiguous array
+//  - Coupled constraints are solved as one block per joint (2x2 point,
+//    2x2 perpendicular/angle, 3x3 weld) instead of axis by axis, which
+//    converges in far fewer iterations for stiff chains
+//  - Accumulated impulses persist between steps for warm starting
+//  - Position drift is corrected with a Baumgarte velocity bias
+
+#include "rigid_body.hpp"
+#include "../math/mat22.hpp"
+#include "../math/mat33.hpp"
+#include <algorithm>  // std::clamp, std::min, std::max
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Solver Settings
+// -----------------------------
+struct JointSolverSettings {
+  double baumgarte{0.2};       ///< fraction of position error removed per step
+  bool warm_starting{true};    ///< reuse last step's impulses
+};
+
+// -----------------------------
+// Joint Definitions
+// -----------------------------
+/// Anchors are in body-local coordinates relative to the centre of mass.
+struct RevoluteJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 local_anchor_a{};
+  Vec2 local_anchor_b{};
+  double reference_angle{0.0};
+  bool enable_limit{false};
+  double lower_angle{0.0};
+  double upper_angle{0.0};
+  bool enable_motor{false};
+  double motor_speed{0.0};
+  double max_motor_torque{0.0};
+};
+
+struct PrismaticJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 local_anchor_a{};
+  Vec2 local_anchor_b{};
+  Vec2 local_axis_a{1.0, 0.0};   ///< unit slide axis in A's frame
+  double reference_angle{0.0};
+  bool enable_limit{false};
+  double lower_translation{0.0};
+  double upper_translation{0.0};
+  bool enable_motor{false};
+  double motor_speed{0.0};
+  double max_motor_force{0.0};
+};
+
+struct WeldJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 local_anchor_a{};
+  Vec2 local_anchor_b{};
+  double reference_angle{0.0};
+};
+
+struct DistanceJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 local_anchor_a{};
+  Vec2 local_anchor_b{};
+  double length{1.0};
+  double frequency_hz{0.0};      ///< 0 = rigid rod, > 0 = spring
+  double damping_ratio{0.0};
+};
+
+struct RopeJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 local_anchor_a{};
+  Vec2 local_anchor_b{};
+  double max_length{1.0};
+};
+
+struct MotorJointDef {
+  int body_a{0};
+  int body_b{0};
+  Vec2 linear_offset{};          ///< target position of B in A's frame
+  double angular_offset{0.0};    ///< target angle of B relative to A
+  double max_force{1.0};
+  double max_torque{1.0};
+  double correction_factor{0.3};
+};
+
+namespace detail {
+
+/// Apply fn to every column of a batch
+template<typename Batch, typename Fn>
+void for_each_column(Batch& batch, Fn&& fn) {
+  std::apply([&](auto&... col) { (fn(col), ...); }, batch.columns());
+}
+
+/// Grow every column by one default element; returns the new index
+template<typename Batch>
+std::size_t append_row(Batch& batch) {
+  const std::size_t n = batch.size();
+  for_each_column(batch, [n](auto& col) { col.resize(n + 1); });
+  return n;
+}
+
+/// O(1) removal: move the last row into slot i
+template<typename Batch>
+void swap_remove_row(Batch& batch, std::size_t i) {
+  for_each_column(batch, [i](auto& col) {
+    col[i] = col.back();
+    col.pop_back();
+  });
+}
+
+struct JointBodies {
+  Vec2 va{};
+  double wa{0.0};
+  Vec2 vb{};
+  double wb{0.0};
+  double ma{0.0};
+  double ia{0.0};
+  double mb{0.0};
+  double ib{0.0};
+};
+
+[[nodiscard]] inline double safe_inverse(double x) noexcept {
+  return x > 0.0 ? 1.0 / x : 0.0;
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────
+// Shared columns
+// ─────────────────────────────────────────────────────────────
+
+/// Columns common to every two-body joint batch
+struct JointBatchBase {
+  std::vector<int> body_a;
+  std::vector<int> body_b;
+  std::vector<double> local_ax, local_ay;   ///< anchor on A (local)
+  std::vector<double> local_bx, local_by;   ///< anchor on B (local)
+
+  // Solver temporaries, rebuilt in prepare()
+  std::vector<double> rax, ray;             ///< rotated anchor arm on A
+  std::vector<double> rbx, rby;             ///< rotated anchor arm on B
+
+  [[nodiscard]] std::size_t size() const noexcept { return body_a.size(); }
+  [[nodiscard]] bool empty() const noexcept { return body_a.empty(); }
+
+protected:
+  auto base_columns() {
+    return std::tie(body_a, body_b, local_ax, local_ay, local_bx, local_by,
+                    rax, ray, rbx, rby);
+  }
+
+  void set_base(std::size_t i, int a, int b, const Vec2& la, const Vec2& lb) {
+    body_a[i] = a;
+    body_b[i] = b;
+    local_ax[i] = la.x;
+    local_ay[i] = la.y;
+    local_bx[i] = lb.x;
+    local_by[i] = lb.y;
+  }
+
+  /// Rotate local anchors into world-aligned arms
+  void prepare_arms(std::size_t i, std::span<const RigidBody> bodies) {
+    const RigidBody& a = bodies[body_a[i]];
+    const RigidBody& b = bodies[body_b[i]];
+    const Vec2 ra = a.rotation().apply(Vec2{local_ax[i], local_ay[i]});
+    const Vec2 rb = b.rotation().apply(Vec2{local_bx[i], local_by[i]});
+    rax[i] = ra.x;
+    ray[i] = ra.y;
+    rbx[i] = rb.x;
+    rby[i] = rb.y;
+  }
+
+  [[nodiscard]] Vec2 arm_a(std::size_t i) const noexcept { return Vec2{rax[i], ray[i]}; }
+  [[nodiscard]] Vec2 arm_b(std::size_t i) const noexcept { return Vec2{rbx[i], rby[i]}; }
+
+  [[nodiscard]] detail::JointBodies load(std::size_t i, std::span<const RigidBody> bodies) const {
+    const RigidBody& a = bodies[body_a[i]];
+    const RigidBody& b = bodies[body_b[i]];
+    return detail::JointBodies{a.linear_velocity, a.angular_velocity,
+                               b.linear_velocity, b.angular_velocity,
+                               a.inv_mass, a.inv_inertia, b.inv_mass, b.inv_inertia};
+  }
+
+  void store(std::size_t i, std::span<RigidBody> bodies, const detail::JointBodies& s) const {
+    RigidBody& a = bodies[body_a[i]];
+    RigidBody& b = bodies[body_b[i]];
+    a.linear_velocity = s.va;
+    a.angular_velocity = s.wa;
+    b.linear_velocity = s.vb;
+    b.angular_velocity = s.wb;
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Revolute: 2x2 point block + optional motor and angle limits
+// ─────────────────────────────────────────────────────────────
+struct RevoluteBatch : JointBatchBase {
+  std::vector<double> reference_angle;
+  std::vector<std::uint8_t> enable_limit, enable_motor;
+  std::vector<double> lower_angle, upper_angle;
+  std::vector<double> motor_speed, max_motor_torque;
+
+  // Solver state
+  std::vector<double> k11, k12, k22;        ///< point effective-mass block
+  std::vector<double> axial_mass;
+  std::vector<double> bias_x, bias_y;
+  std::vector<double> angle;                ///< joint angle at prepare()
+  std::vector<double> impulse_x, impulse_y;
+  std::vector<double> motor_impulse, lower_impulse, upper_impulse;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(),
+      std::tie(reference_angle, enable_limit, enable_motor, lower_angle, upper_angle,
+               motor_speed, max_motor_torque, k11, k12, k22, axial_mass, bias_x, bias_y,
+               angle, impulse_x, impulse_y, motor_impulse, lower_impulse, upper_impulse));
+  }
+
+  std::size_t add(const RevoluteJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, def.local_anchor_a, def.local_anchor_b);
+    reference_angle[i] = def.reference_angle;
+    enable_limit[i] = def.enable_limit;
+    enable_motor[i] = def.enable_motor;
+    lower_angle[i] = std::min(def.lower_angle, def.upper_angle);
+    upper_angle[i] = std::max(def.lower_angle, def.upper_angle);
+    motor_speed[i] = def.motor_speed;
+    max_motor_torque[i] = def.max_motor_torque;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    const double beta = s.baumgarte / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const double ma = a.inv_mass, mb = b.inv_mass;
+      const double ia = a.inv_inertia, ib = b.inv_inertia;
+
+      k11[i] = ma + mb + ia * ra.y * ra.y + ib * rb.y * rb.y;
+      k12[i] = -ia * ra.x * ra.y - ib * rb.x * rb.y;
+      k22[i] = ma + mb + ia * ra.x * ra.x + ib * rb.x * rb.x;
+      axial_mass[i] = detail::safe_inverse(ia + ib);
+
+      const Vec2 c = (b.position + rb) - (a.position + ra);
+      bias_x[i] = beta * c.x;
+      bias_y[i] = beta * c.y;
+      angle[i] = b.angle - a.angle - reference_angle[i];
+
+      if (!s.warm_starting) {
+        impulse_x[i] = impulse_y[i] = 0.0;
+        motor_impulse[i] = lower_impulse[i] = upper_impulse[i] = 0.0;
+      }
+      if (!enable_motor[i]) motor_impulse[i] = 0.0;
+      if (!enable_limit[i]) lower_impulse[i] = upper_impulse[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 p{impulse_x[i], impulse_y[i]};
+      const double axial = motor_impulse[i] + lower_impulse[i] - upper_impulse[i];
+      s.va -= p * s.ma;
+      s.wa -= s.ia * (arm_a(i).cross(p) + axial);
+      s.vb += p * s.mb;
+      s.wb += s.ib * (arm_b(i).cross(p) + axial);
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double dt, const JointSolverSettings& settings) {
+    const double inv_dt = 1.0 / dt;
+    const double beta = settings.baumgarte * inv_dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+
+      if (enable_motor[i]) {
+        const double cdot = s.wb - s.wa - motor_speed[i];
+        const double max_impulse = max_motor_torque[i] * dt;
+        const double old = motor_impulse[i];
+        motor_impulse[i] = std::clamp(old - axial_mass[i] * cdot, -max_impulse, max_impulse);
+        const double imp = motor_impulse[i] - old;
+        s.wa -= s.ia * imp;
+        s.wb += s.ib * imp;
+      }
+
+      if (enable_limit[i]) {
+        // Lower: speculative when inside the range, Baumgarte when violated
+        {
+          const double c = angle[i] - lower_angle[i];
+          const double bias = c > 0.0 ? c * inv_dt : beta * c;
+          const double cdot = s.wb - s.wa;
+          const double old = lower_impulse[i];
+          lower_impulse[i] = std::max(old - axial_mass[i] * (cdot + bias), 0.0);
+          const double imp = lower_impulse[i] - old;
+          s.wa -= s.ia * imp;
+          s.wb += s.ib * imp;
+        }
+        {
+          const double c = upper_angle[i] - angle[i];
+          const double bias = c > 0.0 ? c * inv_dt : beta * c;
+          const double cdot = s.wa - s.wb;
+          const double old = upper_impulse[i];
+          upper_impulse[i] = std::max(old - axial_mass[i] * (cdot + bias), 0.0);
+          const double imp = upper_impulse[i] - old;
+          s.wa += s.ia * imp;
+          s.wb -= s.ib * imp;
+        }
+      }
+
+      // Point block
+      const Vec2 cdot = s.vb + rb.perpendicular() * s.wb - s.va - ra.perpendicular() * s.wa;
+      const Mat22 k{k11[i], k12[i], k12[i], k22[i]};
+      const Vec2 imp = -k.solve(cdot + Vec2{bias_x[i], bias_y[i]});
+      impulse_x[i] += imp.x;
+      impulse_y[i] += imp.y;
+
+      s.va -= imp * s.ma;
+      s.wa -= s.ia * ra.cross(imp);
+      s.vb += imp * s.mb;
+      s.wb += s.ib * rb.cross(imp);
+      store(i, bodies, s);
+    }
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Prismatic: 2x2 (perpendicular, angle) block + axial motor/limits
+// ─────────────────────────────────────────────────────────────
+struct PrismaticBatch : JointBatchBase {
+  std::vector<double> axis_lx, axis_ly;     ///< slide axis in A's frame
+  std::vector<double> reference_angle;
+  std::vector<std::uint8_t> enable_limit, enable_motor;
+  std::vector<double> lower_translation, upper_translation;
+  std::vector<double> motor_speed, max_motor_force;
+
+  // Solver state
+  std::vector<double> axis_x, axis_y;       ///< world slide axis
+  std::vector<double> a1, a2, s1, s2;       ///< angular Jacobian terms
+  std::vector<double> k11, k12, k22;
+  std::vector<double> axial_mass;
+  std::vector<double> bias_perp, bias_angle;
+  std::vector<double> translation;
+  std::vector<double> impulse_perp, impulse_angle;
+  std::vector<double> motor_impulse, lower_impulse, upper_impulse;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(),
+      std::tie(axis_lx, axis_ly, reference_angle, enable_limit, enable_motor,
+               lower_translation, upper_translation, motor_speed, max_motor_force,
+               axis_x, axis_y, a1, a2, s1, s2, k11, k12, k22, axial_mass,
+               bias_perp, bias_angle, translation, impulse_perp, impulse_angle,
+               motor_impulse, lower_impulse, upper_impulse));
+  }
+
+  std::size_t add(const PrismaticJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, def.local_anchor_a, def.local_anchor_b);
+    const Vec2 axis = def.local_axis_a.normalized();
+    axis_lx[i] = axis.x;
+    axis_ly[i] = axis.y;
+    reference_angle[i] = def.reference_angle;
+    enable_limit[i] = def.enable_limit;
+    enable_motor[i] = def.enable_motor;
+    lower_translation[i] = std::min(def.lower_translation, def.upper_translation);
+    upper_translation[i] = std::max(def.lower_translation, def.upper_translation);
+    motor_speed[i] = def.motor_speed;
+    max_motor_force[i] = def.max_motor_force;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    const double beta = s.baumgarte / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const double ma = a.inv_mass, mb = b.inv_mass;
+      const double ia = a.inv_inertia, ib = b.inv_inertia;
+
+      const Vec2 d = (b.position + rb) - (a.position + ra);
+      const Vec2 axis = a.rotation().apply(Vec2{axis_lx[i], axis_ly[i]});
+      const Vec2 perp = axis.perpendicular();
+      axis_x[i] = axis.x;
+      axis_y[i] = axis.y;
+
+      a1[i] = (d + ra).cross(axis);
+      a2[i] = rb.cross(axis);
+      s1[i] = (d + ra).cross(perp);
+      s2[i] = rb.cross(perp);
+
+      axial_mass[i] = detail::safe_inverse(ma + mb + ia * a1[i] * a1[i] + ib * a2[i] * a2[i]);
+
+      k11[i] = ma + mb + ia * s1[i] * s1[i] + ib * s2[i] * s2[i];
+      k12[i] = ia * s1[i] + ib * s2[i];
+      k22[i] = ia + ib;
+      if (k22[i] == 0.0) k22[i] = 1.0;  // both rotations fixed
+
+      bias_perp[i] = beta * perp.dot(d);
+      bias_angle[i] = beta * (b.angle - a.angle - reference_angle[i]);
+      translation[i] = axis.dot(d);
+
+      if (!s.warm_starting) {
+        impulse_perp[i] = impulse_angle[i] = 0.0;
+        motor_impulse[i] = lower_impulse[i] = upper_impulse[i] = 0.0;
+      }
+      if (!enable_motor[i]) motor_impulse[i] = 0.0;
+      if (!enable_limit[i]) lower_impulse[i] = upper_impulse[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 axis{axis_x[i], axis_y[i]};
+      const double axial = motor_impulse[i] + lower_impulse[i] - upper_impulse[i];
+      const Vec2 p = axis.perpendicular() * impulse_perp[i] + axis * axial;
+      const double la = impulse_perp[i] * s1[i] + impulse_angle[i] + axial * a1[i];
+      const double lb = impulse_perp[i] * s2[i] + impulse_angle[i] + axial * a2[i];
+      s.va -= p * s.ma;
+      s.wa -= s.ia * la;
+      s.vb += p * s.mb;
+      s.wb += s.ib * lb;
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double dt, const JointSolverSettings& settings) {
+    const double inv_dt = 1.0 / dt;
+    const double beta = settings.baumgarte * inv_dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 axis{axis_x[i], axis_y[i]};
+      const Vec2 perp = axis.perpendicular();
+
+      auto apply_axial = [&](double imp) {
+        const Vec2 p = axis * imp;
+        s.va -= p * s.ma;
+        s.wa -= s.ia * imp * a1[i];
+        s.vb += p * s.mb;
+        s.wb += s.ib * imp * a2[i];
+      };
+
+      if (enable_motor[i]) {
+        const double cdot = axis.dot(s.vb - s.va) + a2[i] * s.wb - a1[i] * s.wa;
+        const double max_impulse = max_motor_force[i] * dt;
+        const double old = motor_impulse[i];
+        motor_impulse[i] = std::clamp(old + axial_mass[i] * (motor_speed[i] - cdot),
+                                      -max_impulse, max_impulse);
+        apply_axial(motor_impulse[i] - old);
+      }
+
+      if (enable_limit[i]) {
+        {
+          const double c = translation[i] - lower_translation[i];
+          const double bias = c > 0.0 ? c * inv_dt : beta * c;
+          const double cdot = axis.dot(s.vb - s.va) + a2[i] * s.wb - a1[i] * s.wa;
+          const double old = lower_impulse[i];
+          lower_impulse[i] = std::max(old - axial_mass[i] * (cdot + bias), 0.0);
+          apply_axial(lower_impulse[i] - old);
+        }
+        {
+          const double c = upper_translation[i] - translation[i];
+          const double bias = c > 0.0 ? c * inv_dt : beta * c;
+          const double cdot = axis.dot(s.va - s.vb) + a1[i] * s.wa - a2[i] * s.wb;
+          const double old = upper_impulse[i];
+          upper_impulse[i] = std::max(old - axial_mass[i] * (cdot + bias), 0.0);
+          apply_axial(-(upper_impulse[i] - old));
+        }
+      }
+
+      // Perpendicular + angular block
+      const Vec2 cdot{perp.dot(s.vb - s.va) + s2[i] * s.wb - s1[i] * s.wa, s.wb - s.wa};
+      const Mat22 k{k11[i], k12[i], k12[i], k22[i]};
+      const Vec2 imp = -k.solve(cdot + Vec2{bias_perp[i], bias_angle[i]});
+      impulse_perp[i] += imp.x;
+      impulse_angle[i] += imp.y;
+
+      const Vec2 p = perp * imp.x;
+      s.va -= p * s.ma;
+      s.wa -= s.ia * (imp.x * s1[i] + imp.y);
+      s.vb += p * s.mb;
+      s.wb += s.ib * (imp.x * s2[i] + imp.y);
+      store(i, bodies, s);
+    }
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Weld: 3x3 (point, angle) block
+// ─────────────────────────────────────────────────────────────
+struct WeldBatch : JointBatchBase {
+  std::vector<double> reference_angle;
+
+  // Solver state: symmetric inverse of K (6 unique entries)
+  std::vector<double> m11, m12, m13, m22, m23, m33;
+  std::vector<double> bias_x, bias_y, bias_angle;
+  std::vector<double> impulse_x, impulse_y, impulse_angle;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(),
+      std::tie(reference_angle, m11, m12, m13, m22, m23, m33,
+               bias_x, bias_y, bias_angle, impulse_x, impulse_y, impulse_angle));
+  }
+
+  std::size_t add(const WeldJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, def.local_anchor_a, def.local_anchor_b);
+    reference_angle[i] = def.reference_angle;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    const double beta = s.baumgarte / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const double ma = a.inv_mass, mb = b.inv_mass;
+      const double ia = a.inv_inertia, ib = b.inv_inertia;
+
+      Mat33 k;
+      k.ex = Vec3{ma + mb + ra.y * ra.y * ia + rb.y * rb.y * ib,
+                  -ra.y * ra.x * ia - rb.y * rb.x * ib,
+                  -ra.y * ia - rb.y * ib};
+      k.ey = Vec3{k.ex.y, ma + mb + ra.x * ra.x * ia + rb.x * rb.x * ib, ra.x * ia + rb.x * ib};
+      k.ez = Vec3{k.ex.z, k.ey.z, ia + ib};
+
+      Mat33 inv;
+      if (k.ez.z == 0.0) {
+        // Neither body rotates: only the 2x2 point block is meaningful
+        const Mat22 inv2 = Mat22{k.ex.x, k.ey.x, k.ex.y, k.ey.y}.inverse();
+        inv = Mat33::zero();
+        inv.ex.x = inv2.ex.x;
+        inv.ex.y = inv2.ex.y;
+        inv.ey.x = inv2.ey.x;
+        inv.ey.y = inv2.ey.y;
+      } else {
+        inv = k.sym_inverse();
+      }
+      m11[i] = inv.ex.x;
+      m12[i] = inv.ey.x;
+      m13[i] = inv.ez.x;
+      m22[i] = inv.ey.y;
+      m23[i] = inv.ez.y;
+      m33[i] = inv.ez.z;
+
+      const Vec2 c = (b.position + rb) - (a.position + ra);
+      bias_x[i] = beta * c.x;
+      bias_y[i] = beta * c.y;
+      bias_angle[i] = beta * (b.angle - a.angle - reference_angle[i]);
+
+      if (!s.warm_starting) impulse_x[i] = impulse_y[i] = impulse_angle[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 p{impulse_x[i], impulse_y[i]};
+      s.va -= p * s.ma;
+      s.wa -= s.ia * (arm_a(i).cross(p) + impulse_angle[i]);
+      s.vb += p * s.mb;
+      s.wb += s.ib * (arm_b(i).cross(p) + impulse_angle[i]);
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double /*dt*/, const JointSolverSettings& /*s*/) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+
+      const Vec2 cdot1 = s.vb + rb.perpendicular() * s.wb - s.va - ra.perpendicular() * s.wa;
+      const Vec3 rhs{cdot1.x + bias_x[i], cdot1.y + bias_y[i], s.wb - s.wa + bias_angle[i]};
+      const Vec3 imp{-(m11[i] * rhs.x + m12[i] * rhs.y + m13[i] * rhs.z),
+                     -(m12[i] * rhs.x + m22[i] * rhs.y + m23[i] * rhs.z),
+                     -(m13[i] * rhs.x + m23[i] * rhs.y + m33[i] * rhs.z)};
+      impulse_x[i] += imp.x;
+      impulse_y[i] += imp.y;
+      impulse_angle[i] += imp.z;
+
+      const Vec2 p{imp.x, imp.y};
+      s.va -= p * s.ma;
+      s.wa -= s.ia * (ra.cross(p) + imp.z);
+      s.vb += p * s.mb;
+      s.wb += s.ib * (rb.cross(p) + imp.z);
+      store(i, bodies, s);
+    }
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Distance and rope: 1D along the anchor axis
+// ─────────────────────────────────────────────────────────────
+struct DistanceBatch : JointBatchBase {
+  std::vector<double> length, frequency_hz, damping_ratio;
+
+  // Solver state
+  std::vector<double> ux, uy;               ///< unit axis A -> B
+  std::vector<double> mass, bias, gamma;
+  std::vector<double> impulse;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(),
+      std::tie(length, frequency_hz, damping_ratio, ux, uy, mass, bias, gamma, impulse));
+  }
+
+  std::size_t add(const DistanceJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, def.local_anchor_a, def.local_anchor_b);
+    length[i] = def.length;
+    frequency_hz[i] = def.frequency_hz;
+    damping_ratio[i] = def.damping_ratio;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    const double beta = s.baumgarte / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+
+      const Vec2 d = (b.position + rb) - (a.position + ra);
+      const double len = d.length();
+      const Vec2 u = len > 0.0 ? d / len : Vec2{};
+      ux[i] = u.x;
+      uy[i] = u.y;
+
+      const double cra = ra.cross(u);
+      const double crb = rb.cross(u);
+      double inv_k = a.inv_mass + a.inv_inertia * cra * cra + b.inv_mass + b.inv_inertia * crb * crb;
+      const double c = len - length[i];
+
+      if (frequency_hz[i] > 0.0 && inv_k > 0.0) {
+        // Soft constraint: implicit spring-damper folded into the impulse
+        const double m = 1.0 / inv_k;
+        const double omega = 2.0 * std::numbers::pi * frequency_hz[i];
+        const double damp = 2.0 * m * damping_ratio[i] * omega;
+        const double k = m * omega * omega;
+        gamma[i] = detail::safe_inverse(dt * (damp + dt * k));
+        bias[i] = c * dt * k * gamma[i];
+        inv_k += gamma[i];
+      } else {
+        gamma[i] = 0.0;
+        bias[i] = beta * c;
+      }
+      mass[i] = detail::safe_inverse(inv_k);
+
+      if (!s.warm_starting) impulse[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 p = Vec2{ux[i], uy[i]} * impulse[i];
+      s.va -= p * s.ma;
+      s.wa -= s.ia * arm_a(i).cross(p);
+      s.vb += p * s.mb;
+      s.wb += s.ib * arm_b(i).cross(p);
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double /*dt*/, const JointSolverSettings& /*s*/) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const Vec2 u{ux[i], uy[i]};
+
+      const double cdot = u.dot(s.vb + rb.perpendicular() * s.wb - s.va - ra.perpendicular() * s.wa);
+      const double imp = -mass[i] * (cdot + bias[i] + gamma[i] * impulse[i]);
+      impulse[i] += imp;
+
+      const Vec2 p = u * imp;
+      s.va -= p * s.ma;
+      s.wa -= s.ia * ra.cross(p);
+      s.vb += p * s.mb;
+      s.wb += s.ib * rb.cross(p);
+      store(i, bodies, s);
+    }
+  }
+};
+
+struct RopeBatch : JointBatchBase {
+  std::vector<double> max_length;
+
+  // Solver state
+  std::vector<double> ux, uy;
+  std::vector<double> mass, c;
+  std::vector<double> impulse;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(), std::tie(max_length, ux, uy, mass, c, impulse));
+  }
+
+  std::size_t add(const RopeJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, def.local_anchor_a, def.local_anchor_b);
+    max_length[i] = def.max_length;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double /*dt*/, const JointSolverSettings& s) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+
+      const Vec2 d = (b.position + rb) - (a.position + ra);
+      const double len = d.length();
+      const Vec2 u = len > 0.0 ? d / len : Vec2{};
+      ux[i] = u.x;
+      uy[i] = u.y;
+      c[i] = len - max_length[i];
+
+      const double cra = ra.cross(u);
+      const double crb = rb.cross(u);
+      mass[i] = detail::safe_inverse(a.inv_mass + a.inv_inertia * cra * cra +
+                                     b.inv_mass + b.inv_inertia * crb * crb);
+
+      if (!s.warm_starting) impulse[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 p = Vec2{ux[i], uy[i]} * impulse[i];
+      s.va -= p * s.ma;
+      s.wa -= s.ia * arm_a(i).cross(p);
+      s.vb += p * s.mb;
+      s.wb += s.ib * arm_b(i).cross(p);
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double dt, const JointSolverSettings& settings) {
+    const double inv_dt = 1.0 / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const Vec2 u{ux[i], uy[i]};
+
+      // Slack rope: only stop the approach to full length
+      double cdot = u.dot(s.vb + rb.perpendicular() * s.wb - s.va - ra.perpendicular() * s.wa);
+      cdot += c[i] < 0.0 ? inv_dt * c[i] : settings.baumgarte * inv_dt * c[i];
+
+      const double old = impulse[i];
+      impulse[i] = std::min(0.0, old - mass[i] * cdot);
+      const double imp = impulse[i] - old;
+
+      const Vec2 p = u * imp;
+      s.va -= p * s.ma;
+      s.wa -= s.ia * ra.cross(p);
+      s.vb += p * s.mb;
+      s.wb += s.ib * rb.cross(p);
+      store(i, bodies, s);
+    }
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Motor: drives B towards an offset pose in A's frame
+// ─────────────────────────────────────────────────────────────
+struct MotorBatch : JointBatchBase {
+  std::vector<double> offset_x, offset_y, angular_offset;
+  std::vector<double> max_force, max_torque, correction_factor;
+
+  // Solver state
+  std::vector<double> k11, k12, k22;
+  std::vector<double> angular_mass;
+  std::vector<double> error_x, error_y, error_angle;
+  std::vector<double> impulse_x, impulse_y, impulse_angle;
+
+  auto columns() {
+    return std::tuple_cat(base_columns(),
+      std::tie(offset_x, offset_y, angular_offset, max_force, max_torque, correction_factor,
+               k11, k12, k22, angular_mass, error_x, error_y, error_angle,
+               impulse_x, impulse_y, impulse_angle));
+  }
+
+  std::size_t add(const MotorJointDef& def) {
+    const std::size_t i = detail::append_row(*this);
+    set_base(i, def.body_a, def.body_b, Vec2{}, Vec2{});
+    offset_x[i] = def.linear_offset.x;
+    offset_y[i] = def.linear_offset.y;
+    angular_offset[i] = def.angular_offset;
+    max_force[i] = def.max_force;
+    max_torque[i] = def.max_torque;
+    correction_factor[i] = def.correction_factor;
+    return i;
+  }
+
+  void remove(std::size_t i) { detail::swap_remove_row(*this, i); }
+
+  void prepare(std::span<const RigidBody> bodies, double /*dt*/, const JointSolverSettings& s) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      prepare_arms(i, bodies);
+      const RigidBody& a = bodies[body_a[i]];
+      const RigidBody& b = bodies[body_b[i]];
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const double ma = a.inv_mass, mb = b.inv_mass;
+      const double ia = a.inv_inertia, ib = b.inv_inertia;
+
+      k11[i] = ma + mb + ia * ra.y * ra.y + ib * rb.y * rb.y;
+      k12[i] = -ia * ra.x * ra.y - ib * rb.x * rb.y;
+      k22[i] = ma + mb + ia * ra.x * ra.x + ib * rb.x * rb.x;
+      angular_mass[i] = detail::safe_inverse(ia + ib);
+
+      const Vec2 target = a.rotation().apply(Vec2{offset_x[i], offset_y[i]});
+      const Vec2 err = (b.position + rb) - (a.position + ra) - target;
+      error_x[i] = err.x;
+      error_y[i] = err.y;
+      error_angle[i] = b.angle - a.angle - angular_offset[i];
+
+      if (!s.warm_starting) impulse_x[i] = impulse_y[i] = impulse_angle[i] = 0.0;
+    }
+  }
+
+  void warm_start(std::span<RigidBody> bodies) const {
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 p{impulse_x[i], impulse_y[i]};
+      s.va -= p * s.ma;
+      s.wa -= s.ia * (arm_a(i).cross(p) + impulse_angle[i]);
+      s.vb += p * s.mb;
+      s.wb += s.ib * (arm_b(i).cross(p) + impulse_angle[i]);
+      store(i, bodies, s);
+    }
+  }
+
+  void solve(std::span<RigidBody> bodies, double dt, const JointSolverSettings& /*s*/) {
+    const double inv_dt = 1.0 / dt;
+    for (std::size_t i = 0; i < size(); ++i) {
+      detail::JointBodies s = load(i, bodies);
+      const Vec2 ra = arm_a(i);
+      const Vec2 rb = arm_b(i);
+      const double correction = correction_factor[i] * inv_dt;
+
+      {
+        const double cdot = s.wb - s.wa + correction * error_angle[i];
+        const double max_impulse = max_torque[i] * dt;
+        const double old = impulse_angle[i];
+        impulse_angle[i] = std::clamp(old - angular_mass[i] * cdot, -max_impulse, max_impulse);
+        const double imp = impulse_angle[i] - old;
+        s.wa -= s.ia * imp;
+        s.wb += s.ib * imp;
+      }
+
+      {
+        const Vec2 cdot = s.vb + rb.perpendicular() * s.wb - s.va - ra.perpendicular() * s.wa
+                        + Vec2{error_x[i], error_y[i]} * correction;
+        const Mat22 k{k11[i], k12[i], k12[i], k22[i]};
+        const Vec2 old{impulse_x[i], impulse_y[i]};
+        Vec2 acc = old - k.solve(cdot);
+
+        // Friction-like clamp on the accumulated linear impulse
+        const double max_impulse = max_force[i] * dt;
+        if (acc.length_sq() > max_impulse * max_impulse) acc = acc.normalized() * max_impulse;
+        impulse_x[i] = acc.x;
+        impulse_y[i] = acc.y;
+
+        const Vec2 imp = acc - old;
+        s.va -= imp * s.ma;
+        s.wa -= s.ia * ra.cross(imp);
+        s.vb += imp * s.mb;
+        s.wb += s.ib * rb.cross(imp);
+      }
+      store(i, bodies, s);
+    }
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Joint Set
+// ─────────────────────────────────────────────────────────────
+/// All joints of a world, grouped by type. Each solver phase walks the
+/// batches in a fixed order, so the inner loops stay monomorphic.
+struct JointSet {
+  RevoluteBatch revolute;
+  PrismaticBatch prismatic;
+  WeldBatch weld;
+  DistanceBatch distance;
+  RopeBatch rope;
+  MotorBatch motor;
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return revolute.size() + prismatic.size() + weld.size() +
+           distance.size() + rope.size() + motor.size();
+  }
+
+  void prepare(std::span<const RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    for_each_batch([&](auto& batch) { batch.prepare(bodies, dt, s); });
+  }
+
+  void warm_start(std::span<RigidBody> bodies) {
+    for_each_batch([&](auto& batch) { batch.warm_start(bodies); });
+  }
+
+  void solve_velocities(std::span<RigidBody> bodies, double dt, const JointSolverSettings& s) {
+    for_each_batch([&](auto& batch) { batch.solve(bodies, dt, s); });
+  }
+
+  /// prepare + warm start + iterations of velocity solving
+  void solve(std::span<RigidBody> bodies, double dt, int iterations,
+             const JointSolverSettings& s = {}) {
+    prepare(bodies, dt, s);
+    if (s.warm_starting) warm_start(bodies);
+    for (int it = 0; it < iterations; ++it) solve_velocities(bodies, dt, s);
+  }
+
+private:
+  template<typename Fn>
+  void for_each_batch(Fn&& fn) {
+    fn(revolute);
+    fn(prismatic);
+    fn(weld);
+    fn(distance);
+    fn(rope);
+    fn(motor);
+  }
+};
+
+} // namespace sim
+
+#endif // SIM_JOINTS_HPP
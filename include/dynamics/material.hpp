@@ -0,0 +1,151 @@
+#pragma once
+#ifndef SIM_MATERIAL_HPP
+#define SIM_MATERIAL_HPP
+// include/dynamics/material.hpp
+// Surface materials and the precombined material-pair table
+//
+// Design notes:
+//  - Bodies, colliders and particles carry a 16-bit MaterialId. Every
+//    (a, b) combination is combined once, when materials are added or
+//    changed, into a dense N x N table; contact setup is then a single
+//    indexed load instead of a combine call per contact
+//  - Combine rules follow the PhysX convention: when two materials ask
+//    for different rules, the one later in CombineRule wins
+//  - Id 0 is always the default material
+
+#include <algorithm>  // std::min, std::max
+#include <cassert>
+#include <cmath>      // std::sqrt
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+using MaterialId = std::uint16_t;
+inline constexpr MaterialId kDefaultMaterial = 0;
+
+enum class CombineRule : std::uint8_t {
+  average,
+  geometric,   ///< sqrt(a * b), Box2D's friction rule
+  min,
+  multiply,
+  max,
+};
+
+struct Material {
+  double friction{0.6};
+  double restitution{0.0};
+  double rolling_resistance{0.0};   ///< dimensionless; scaled by the rolling radius
+  CombineRule friction_rule{CombineRule::geometric};
+  CombineRule restitution_rule{CombineRule::max};
+};
+
+/// Combined coefficients for one material pair
+struct MaterialPair {
+  double friction{0.0};
+  double restitution{0.0};
+  double rolling_resistance{0.0};
+};
+
+[[nodiscard]] inline double combine(double a, double b, CombineRule rule) noexcept {
+  switch (rule) {
+    case CombineRule::average:   return 0.5 * (a + b);
+    case CombineRule::geometric: return std::sqrt(a * b);
+    case CombineRule::min:       return std::min(a, b);
+    case CombineRule::multiply:  return a * b;
+    case CombineRule::max:       return std::max(a, b);
+  }
+  return a;
+}
+
+[[nodiscard]] inline MaterialPair combine(const Material& a, const Material& b) noexcept {
+  return MaterialPair{
+    combine(a.friction, b.friction, std::max(a.friction_rule, b.friction_rule)),
+    combine(a.restitution, b.restitution, std::max(a.restitution_rule, b.restitution_rule)),
+    std::max(a.rolling_resistance, b.rolling_resistance)};
+}
+
+// -----------------------------
+// Material Table
+// -----------------------------
+class MaterialTable {
+public:
+  MaterialTable() { add(Material{}); }
+
+  /// Register a material; rebuilds the pair table
+  MaterialId add(const Material& m) {
+    assert(materials_.size() < 0xFFFF && "MaterialId space exhausted");
+    materials_.push_back(m);
+    rebuild();
+    return static_cast<MaterialId>(materials_.size() - 1);
+  }
+
+  /// Change a material in place; only its row and column are recombined
+  void set(MaterialId id, const Material& m) {
+    materials_[id] = m;
+    const std::size_t n = materials_.size();
+    for (std::size_t other = 0; other < n; ++other) {
+      const MaterialPair p = combine(materials_[id], materials_[other]);
+      pairs_[id * n + other] = p;
+      pairs_[other * n + id] = p;
+    }
+    apply_overrides();
+  }
+
+  /// Replace the combined coefficients of one pair (both orders)
+  void override_pair(MaterialId a, MaterialId b, const MaterialPair& p) {
+    for (Override& o : overrides_) {
+      if ((o.a == a && o.b == b) || (o.a == b && o.b == a)) {
+        o.pair = p;
+        apply_overrides();
+        return;
+      }
+    }
+    overrides_.push_back(Override{a, b, p});
+    apply_overrides();
+  }
+
+  /// The hot path: one indexed load
+  [[nodiscard]] const MaterialPair& pair(MaterialId a, MaterialId b) const noexcept {
+    return pairs_[static_cast<std::size_t>(a) * materials_.size() + b];
+  }
+
+  [[nodiscard]] const Material& material(MaterialId id) const noexcept { return materials_[id]; }
+  [[nodiscard]] std::size_t size() const noexcept { return materials_.size(); }
+
+private:
+  struct Override {
+    MaterialId a;
+    MaterialId b;
+    MaterialPair pair;
+  };
+
+  void rebuild() {
+    const std::size_t n = materials_.size();
+    pairs_.resize(n * n);
+    for (std::size_t a = 0; a < n; ++a) {
+      for (std::size_t b = a; b < n; ++b) {
+        const MaterialPair p = combine(materials_[a], materials_[b]);
+        pairs_[a * n + b] = p;
+        pairs_[b * n + a] = p;
+      }
+    }
+    apply_overrides();
+  }
+
+  void apply_overrides() {
+    const std::size_t n = materials_.size();
+    for (const Override& o : overrides_) {
+      pairs_[static_cast<std::size_t>(o.a) * n + o.b] = o.pair;
+      pairs_[static_cast<std::size_t>(o.b) * n + o.a] = o.pair;
+    }
+  }
+
+  std::vector<Material> materials_;
+  std::vector<MaterialPair> pairs_;
+  std::vector<Override> overrides_;
+};
+
+} // namespace sim
+
+#endif // SIM_MATERIAL_HPP
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef SIM_RIGID_BODY_HPP
+#define SIM_RIGID_BODY_HPP
+// include/dynamics/rigid_body.hpp
+// Rigid body state and semi-implicit Euler integration
+//
+// Design notes:
+//  - position is the centre of mass; shapes and joint anchors are
+//    expressed relative to it
+//  - inv_mass == 0 marks a static (or kinematic) body, so solvers can
+//    apply impulses unconditionally
+
+#include "material.hpp"
+#include "../math/transform2.hpp"
+#include "../math/vec2.hpp"
+#include <span>
+
+namespace sim {
+
+// -----------------------------
+// Rigid Body
+// -----------------------------
+struct RigidBody {
+  Vec2 position{};              ///< centre of mass (world)
+  double angle{0.0};            ///< radians
+  Vec2 linear_velocity{};
+  double angular_velocity{0.0};
+  Vec2 force{};                 ///< accumulated for the current step
+  double torque{0.0};
+  double inv_mass{0.0};         ///< 0 for static bodies
+  double inv_inertia{0.0};      ///< about the centre of mass
+  MaterialId material{kDefaultMaterial};
+
+  [[nodiscard]] constexpr bool is_static() const noexcept {
+    return inv_mass == 0.0 && inv_inertia == 0.0;
+  }
+
+  [[nodiscard]] Rot2 rotation() const noexcept { return Rot2::from_angle(angle); }
+
+  [[nodiscard]] Transform2 transform() const noexcept {
+    return Transform2{position, rotation()};
+  }
+
+  /// Velocity of a world point attached to the body, given r = point - position
+  [[nodiscard]] constexpr Vec2 velocity_at(const Vec2& r) const noexcept {
+    return linear_velocity + r.perpendicular() * angular_velocity;
+  }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Integration
+// ─────────────────────────────────────────────────────────────
+
+/// v += dt * (g + F/m), w += dt * T/I; clears accumulated forces
+inline void integrate_velocities(std::span<RigidBody> bodies, const Vec2& gravity,
+                                 double dt) noexcept {
+  for (RigidBody& b : bodies) {
+    if (b.inv_mass > 0.0) b.linear_velocity += (gravity + b.force * b.inv_mass) * dt;
+    b.angular_velocity += b.torque * b.inv_inertia * dt;
+    b.force = Vec2{};
+    b.torque = 0.0;
+  }
+}
+
+/// x += dt * v, angle += dt * w
+inline void integrate_positions(std::span<RigidBody> bodies, double dt) noexcept {
+  for (RigidBody& b : bodies) {
+    b.position += b.linear_velocity * dt;
+    b.angle += b.angular_velocity * dt;
+  }
+}
+
+} // namespace sim
+
+#endif // SIM_RIGID_BODY_HPP
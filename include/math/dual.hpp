@@ -0,0 +1,187 @@
+#pragma once
+#ifndef SIM_DUAL_HPP
+#define SIM_DUAL_HPP
+// include/math/dual.hpp
+// Forward-mode automatic differentiation: a value with N directional
+// derivatives that propagate through ordinary arithmetic
+//
+// Design notes:
+//  - Dual<N> carries d(value)/d(seed k) for k < N seeds in one pass, so a
+//    rollout run once with Dual<N> gives the derivatives of every output
+//    with respect to N chosen inputs or parameters
+//  - Plain doubles convert implicitly (zero derivative), so constants in
+//    force laws and integrators need no changes; code written against a
+//    scalar T with ADL math (using std::sqrt; sqrt(x)) works unchanged
+//  - Comparisons look at the value only: branches (contact tests, clamps)
+//    pick the same side as the double code, and the derivative is that
+//    of the branch taken
+//  - Registered as NumberLike, so BasicVec2<Dual<N>> is a vector of duals
+
+#include "../core/concepts.hpp"
+#include <array>
+#include <cmath>      // std::sqrt, std::sin, std::cos, std::exp, std::log, std::pow, std::abs
+#include <compare>    // std::partial_ordering
+#include <cstddef>
+
+namespace sim {
+
+// -----------------------------
+// Dual Number
+// -----------------------------
+template<std::size_t N>
+struct Dual {
+  double v{0.0};                ///< value
+  std::array<double, N> d{};    ///< derivatives with respect to the N seeds
+
+  constexpr Dual() noexcept = default;
+  constexpr Dual(double value) noexcept : v(value) {}   // NOLINT: implicit by design
+  constexpr Dual(double value, const std::array<double, N>& derivs) noexcept
+      : v(value), d(derivs) {}
+
+  /// Independent variable number k: derivative 1 along seed k, 0 elsewhere
+  [[nodiscard]] static constexpr Dual variable(double value, std::size_t k) noexcept {
+    Dual r{value};
+    r.d[k] = 1.0;
+    return r;
+  }
+
+  // ─────────────────────────────────────────────────────────────
+  // Arithmetic operators
+  // ─────────────────────────────────────────────────────────────
+  [[nodiscard]] constexpr Dual operator-() const noexcept {
+    Dual r{-v};
+    for (std::size_t k = 0; k < N; ++k) r.d[k] = -d[k];
+    return r;
+  }
+
+  constexpr Dual& operator+=(const Dual& o) noexcept {
+    v += o.v;
+    for (std::size_t k = 0; k < N; ++k) d[k] += o.d[k];
+    return *this;
+  }
+
+  constexpr Dual& operator-=(const Dual& o) noexcept {
+    v -= o.v;
+    for (std::size_t k = 0; k < N; ++k) d[k] -= o.d[k];
+    return *this;
+  }
+
+  constexpr Dual& operator*=(const Dual& o) noexcept {
+    for (std::size_t k = 0; k < N; ++k) d[k] = d[k] * o.v + v * o.d[k];
+    v *= o.v;
+    return *this;
+  }
+
+  constexpr Dual& operator/=(const Dual& o) noexcept {
+    const double inv = 1.0 / o.v;
+    v *= inv;
+    for (std::size_t k = 0; k < N; ++k) d[k] = (d[k] - v * o.d[k]) * inv;
+    return *this;
+  }
+
+  /// Scaling by a plain number skips the product rule
+  constexpr Dual& operator*=(Scalar auto s) noexcept {
+    v *= s;
+    for (std::size_t k = 0; k < N; ++k) d[k] *= s;
+    return *this;
+  }
+
+  constexpr Dual& operator/=(Scalar auto s) noexcept {
+    const double inv = 1.0 / static_cast<double>(s);
+    return *this *= inv;
+  }
+
+  [[nodiscard]] friend constexpr Dual operator+(Dual a, const Dual& b) noexcept { return a += b; }
+  [[nodiscard]] friend constexpr Dual operator-(Dual a, const Dual& b) noexcept { return a -= b; }
+  [[nodiscard]] friend constexpr Dual operator*(Dual a, const Dual& b) noexcept { return a *= b; }
+  [[nodiscard]] friend constexpr Dual operator/(Dual a, const Dual& b) noexcept { return a /= b; }
+
+  [[nodiscard]] friend constexpr Dual operator*(Dual a, Scalar auto s) noexcept { return a *= s; }
+  [[nodiscard]] friend constexpr Dual operator*(Scalar auto s, Dual a) noexcept { return a *= s; }
+  [[nodiscard]] friend constexpr Dual operator/(Dual a, Scalar auto s) noexcept { return a /= s; }
+
+  // ─────────────────────────────────────────────────────────────
+  // Comparison (value only)
+  // ─────────────────────────────────────────────────────────────
+  [[nodiscard]] friend constexpr bool operator==(const Dual& a, const Dual& b) noexcept {
+    return a.v == b.v;
+  }
+  [[nodiscard]] friend constexpr std::partial_ordering operator<=>(const Dual& a,
+                                                                   const Dual& b) noexcept {
+    return a.v <=> b.v;
+  }
+};
+
+template<std::size_t N>
+struct is_number_like<Dual<N>> : std::true_type {};
+
+// -----------------------------
+// Elementary Functions
+// -----------------------------
+// Found by ADL from generic code that writes `using std::sqrt; sqrt(x)`
+
+namespace detail {
+/// f(a) given f(a.v) and f'(a.v): the chain rule applied to every seed
+template<std::size_t N>
+[[nodiscard]] constexpr Dual<N> chain(const Dual<N>& a, double value, double slope) noexcept {
+  Dual<N> r{value};
+  for (std::size_t k = 0; k < N; ++k) r.d[k] = slope * a.d[k];
+  return r;
+}
+} // namespace detail
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> sqrt(const Dual<N>& a) noexcept {
+  const double s = std::sqrt(a.v);
+  return detail::chain(a, s, 0.5 / s);
+}
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> sin(const Dual<N>& a) noexcept {
+  return detail::chain(a, std::sin(a.v), std::cos(a.v));
+}
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> cos(const Dual<N>& a) noexcept {
+  return detail::chain(a, std::cos(a.v), -std::sin(a.v));
+}
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> exp(const Dual<N>& a) noexcept {
+  const double e = std::exp(a.v);
+  return detail::chain(a, e, e);
+}
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> log(const Dual<N>& a) noexcept {
+  return detail::chain(a, std::log(a.v), 1.0 / a.v);
+}
+
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> abs(const Dual<N>& a) noexcept {
+  return a.v < 0.0 ? -a : a;
+}
+
+/// a^p for a constant exponent
+template<std::size_t N>
+[[nodiscard]] inline Dual<N> pow(const Dual<N>& a, double p) noexcept {
+  return detail::chain(a, std::pow(a.v, p), p * std::pow(a.v, p - 1.0));
+}
+
+// ─────────────────────────────────────────────────────────────
+// Value / derivative access that also accepts plain numbers
+// ─────────────────────────────────────────────────────────────
+[[nodiscard]] constexpr double value_of(double x) noexcept { return x; }
+
+template<std::size_t N>
+[[nodiscard]] constexpr double value_of(const Dual<N>& x) noexcept { return x.v; }
+
+/// d(x)/d(seed k)
+template<std::size_t N>
+[[nodiscard]] constexpr double derivative(const Dual<N>& x, std::size_t k) noexcept {
+  return x.d[k];
+}
+
+} // namespace sim
+
+#endif // SIM_DUAL_HPP
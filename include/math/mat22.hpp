@@ -0,0 +1,52 @@
+#pragma once
+#ifndef SIM_MAT22_HPP
+#define SIM_MAT22_HPP
+// include/math/mat22.hpp
+// 2x2 matrix for small constraint blocks
+//
+// Design notes:
+//  - Column-major (ex, ey) like the rest of the 2D math
+//  - solve() uses Cramer's rule; singular matrices yield zero
+
+#include "vec2.hpp"
+
+namespace sim {
+
+// -----------------------------
+// 2x2 Matrix
+// -----------------------------
+struct Mat22 {
+  Vec2 ex{1.0, 0.0};  ///< first column
+  Vec2 ey{0.0, 1.0};  ///< second column
+
+  constexpr Mat22() noexcept = default;
+  constexpr Mat22(const Vec2& ex_, const Vec2& ey_) noexcept : ex(ex_), ey(ey_) {}
+  constexpr Mat22(double a11, double a12, double a21, double a22) noexcept
+    : ex(a11, a21), ey(a12, a22) {}
+
+  [[nodiscard]] constexpr double determinant() const noexcept {
+    return ex.x * ey.y - ey.x * ex.y;
+  }
+
+  [[nodiscard]] constexpr Vec2 operator*(const Vec2& v) const noexcept {
+    return Vec2{ex.x * v.x + ey.x * v.y, ex.y * v.x + ey.y * v.y};
+  }
+
+  /// Inverse; zero matrix if singular
+  [[nodiscard]] constexpr Mat22 inverse() const noexcept {
+    double det = determinant();
+    if (det != 0.0) det = 1.0 / det;
+    return Mat22{det * ey.y, -det * ey.x, -det * ex.y, det * ex.x};
+  }
+
+  /// Solve A * x = b without forming the inverse
+  [[nodiscard]] constexpr Vec2 solve(const Vec2& b) const noexcept {
+    double det = determinant();
+    if (det != 0.0) det = 1.0 / det;
+    return Vec2{det * (ey.y * b.x - ey.x * b.y), det * (ex.x * b.y - ex.y * b.x)};
+  }
+};
+
+} // namespace sim
+
+#endif // SIM_MAT22_HPP
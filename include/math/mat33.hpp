@@ -0,0 +1,149 @@
+#pragma once
+#ifndef SIM_MAT33_HPP
+#define SIM_MAT33_HPP
+// include/math/mat33.hpp
+// 3-vector and 3x3 matrix for (x, y, angle) constraint blocks and
+// planar spatial algebra
+//
+// Design notes:
+//  - Column-major (ex, ey, ez), mirrors Mat22
+//  - solve() uses Cramer's rule; singular matrices yield zero
+
+#include "vec2.hpp"
+
+namespace sim {
+
+// -----------------------------
+// 3D Vector
+// -----------------------------
+struct Vec3 {
+  double x{0.0};
+  double y{0.0};
+  double z{0.0};
+
+  constexpr Vec3() noexcept = default;
+  constexpr Vec3(double x_, double y_, double z_) noexcept : x(x_), y(y_), z(z_) {}
+  constexpr Vec3(double x_, const Vec2& yz) noexcept : x(x_), y(yz.x), z(yz.y) {}
+
+  [[nodiscard]] constexpr Vec3 operator+(const Vec3& o) const noexcept {
+    return Vec3{x + o.x, y + o.y, z + o.z};
+  }
+
+  [[nodiscard]] constexpr Vec3 operator-(const Vec3& o) const noexcept {
+    return Vec3{x - o.x, y - o.y, z - o.z};
+  }
+
+  [[nodiscard]] constexpr Vec3 operator*(double s) const noexcept {
+    return Vec3{x * s, y * s, z * s};
+  }
+
+  [[nodiscard]] constexpr Vec3 operator-() const noexcept {
+    return Vec3{-x, -y, -z};
+  }
+
+  constexpr Vec3& operator+=(const Vec3& o) noexcept {
+    x += o.x;
+    y += o.y;
+    z += o.z;
+    return *this;
+  }
+
+  constexpr Vec3& operator-=(const Vec3& o) noexcept {
+    x -= o.x;
+    y -= o.y;
+    z -= o.z;
+    return *this;
+  }
+
+  [[nodiscard]] constexpr bool operator==(const Vec3&) const noexcept = default;
+
+  [[nodiscard]] constexpr double dot(const Vec3& o) const noexcept {
+    return x * o.x + y * o.y + z * o.z;
+  }
+
+  [[nodiscard]] constexpr Vec3 cross(const Vec3& o) const noexcept {
+    return Vec3{y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x};
+  }
+};
+
+// -----------------------------
+// 3x3 Matrix
+// -----------------------------
+struct Mat33 {
+  Vec3 ex{1.0, 0.0, 0.0};  ///< first column
+  Vec3 ey{0.0, 1.0, 0.0};  ///< second column
+  Vec3 ez{0.0, 0.0, 1.0};  ///< third column
+
+  constexpr Mat33() noexcept = default;
+  constexpr Mat33(const Vec3& ex_, const Vec3& ey_, const Vec3& ez_) noexcept
+    : ex(ex_), ey(ey_), ez(ez_) {}
+
+  [[nodiscard]] static constexpr Mat33 zero() noexcept {
+    return Mat33{Vec3{}, Vec3{}, Vec3{}};
+  }
+
+  [[nodiscard]] constexpr Vec3 operator*(const Vec3& v) const noexcept {
+    return ex * v.x + ey * v.y + ez * v.z;
+  }
+
+  [[nodiscard]] constexpr Mat33 operator*(const Mat33& o) const noexcept {
+    return Mat33{*this * o.ex, *this * o.ey, *this * o.ez};
+  }
+
+  [[nodiscard]] constexpr Mat33 operator+(const Mat33& o) const noexcept {
+    return Mat33{ex + o.ex, ey + o.ey, ez + o.ez};
+  }
+
+  [[nodiscard]] constexpr Mat33 operator-(const Mat33& o) const noexcept {
+    return Mat33{ex - o.ex, ey - o.ey, ez - o.ez};
+  }
+
+  [[nodiscard]] constexpr Mat33 transposed() const noexcept {
+    return Mat33{Vec3{ex.x, ey.x, ez.x}, Vec3{ex.y, ey.y, ez.y}, Vec3{ex.z, ey.z, ez.z}};
+  }
+
+  /// Outer product a * b^T
+  [[nodiscard]] static constexpr Mat33 outer(const Vec3& a, const Vec3& b) noexcept {
+    return Mat33{a * b.x, a * b.y, a * b.z};
+  }
+
+  /// Solve A * x = b
+  [[nodiscard]] constexpr Vec3 solve(const Vec3& b) const noexcept {
+    double det = ex.dot(ey.cross(ez));
+    if (det != 0.0) det = 1.0 / det;
+    return Vec3{det * b.dot(ey.cross(ez)), det * ex.dot(b.cross(ez)), det * ex.dot(ey.cross(b))};
+  }
+
+  /// Solve the upper-left 2x2 block only
+  [[nodiscard]] constexpr Vec2 solve22(const Vec2& b) const noexcept {
+    double det = ex.x * ey.y - ey.x * ex.y;
+    if (det != 0.0) det = 1.0 / det;
+    return Vec2{det * (ey.y * b.x - ey.x * b.y), det * (ex.x * b.y - ex.y * b.x)};
+  }
+
+  /// Inverse of a symmetric matrix; zero if singular
+  [[nodiscard]] constexpr Mat33 sym_inverse() const noexcept {
+    double det = ex.dot(ey.cross(ez));
+    if (det != 0.0) det = 1.0 / det;
+
+    const double a11 = ex.x, a12 = ey.x, a13 = ez.x;
+    const double a22 = ey.y, a23 = ez.y;
+    const double a33 = ez.z;
+
+    Mat33 m;
+    m.ex.x = det * (a22 * a33 - a23 * a23);
+    m.ex.y = det * (a13 * a23 - a12 * a33);
+    m.ex.z = det * (a12 * a23 - a13 * a22);
+    m.ey.x = m.ex.y;
+    m.ey.y = det * (a11 * a33 - a13 * a13);
+    m.ey.z = det * (a13 * a12 - a11 * a23);
+    m.ez.x = m.ex.z;
+    m.ez.y = m.ey.z;
+    m.ez.z = det * (a11 * a22 - a12 * a12);
+    return m;
+  }
+};
+
+} // namespace sim
+
+#endif // SIM_MAT33_HPP
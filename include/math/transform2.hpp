@@ -0,0 +1,89 @@
+#pragma once
+#ifndef SIM_TRANSFORM2_HPP
+#define SIM_TRANSFORM2_HPP
+// include/math/transform2.hpp
+// 2D rotation and rigid transform (rotation + translation)
+//
+// Design notes:
+//  - Rotation stored as cosine/sine pair so applying it needs no trig
+//  - inv_* helpers map world-space data into a local frame, which is
+//    what the narrowphase works in
+
+#include "vec2.hpp"
+#include <cmath>      // std::cos, std::sin, std::atan2
+
+namespace sim {
+
+// -----------------------------
+// 2D Rotation
+// -----------------------------
+struct Rot2 {
+  double c{1.0};  ///< cosine of the angle
+  double s{0.0};  ///< sine of the angle
+
+  constexpr Rot2() noexcept = default;
+  constexpr Rot2(double c_, double s_) noexcept : c(c_), s(s_) {}
+
+  /// Build a rotation from an angle in radians
+  [[nodiscard]] static Rot2 from_angle(double radians) noexcept {
+    return Rot2{std::cos(radians), std::sin(radians)};
+  }
+
+  /// Angle in radians, in (-pi, pi]
+  [[nodiscard]] double angle() const noexcept { return std::atan2(s, c); }
+
+  /// Rotate a vector by this rotation
+  [[nodiscard]] constexpr Vec2 apply(const Vec2& v) const noexcept {
+    return Vec2{c * v.x - s * v.y, s * v.x + c * v.y};
+  }
+
+  /// Rotate a vector by the inverse of this rotation
+  [[nodiscard]] constexpr Vec2 inv_apply(const Vec2& v) const noexcept {
+    return Vec2{c * v.x + s * v.y, -s * v.x + c * v.y};
+  }
+
+  /// Composition: (this * o).apply(v) == this->apply(o.apply(v))
+  [[nodiscard]] constexpr Rot2 operator*(const Rot2& o) const noexcept {
+    return Rot2{c * o.c - s * o.s, s * o.c + c * o.s};
+  }
+
+  /// Relative rotation: this^-1 * o
+  [[nodiscard]] constexpr Rot2 inv_mul(const Rot2& o) const noexcept {
+    return Rot2{c * o.c + s * o.s, c * o.s - s * o.c};
+  }
+};
+
+// -----------------------------
+// 2D Rigid Transform
+// -----------------------------
+struct Transform2 {
+  Vec2 p{};   ///< translation
+  Rot2 q{};   ///< rotation
+
+  constexpr Transform2() noexcept = default;
+  constexpr Transform2(const Vec2& p_, const Rot2& q_) noexcept : p(p_), q(q_) {}
+
+  /// Map a local point into the parent frame
+  [[nodiscard]] constexpr Vec2 apply(const Vec2& v) const noexcept {
+    return q.apply(v) + p;
+  }
+
+  /// Map a parent-frame point into the local frame
+  [[nodiscard]] constexpr Vec2 inv_apply(const Vec2& v) const noexcept {
+    return q.inv_apply(v - p);
+  }
+
+  /// Composition: (this * o).apply(v) == this->apply(o.apply(v))
+  [[nodiscard]] constexpr Transform2 operator*(const Transform2& o) const noexcept {
+    return Transform2{q.apply(o.p) + p, q * o.q};
+  }
+
+  /// Relative transform: this^-1 * o (o expressed in this frame)
+  [[nodiscard]] constexpr Transform2 inv_mul(const Transform2& o) const noexcept {
+    return Transform2{q.inv_apply(o.p - p), q.inv_mul(o.q)};
+  }
+};
+
+} // namespace sim
+
+#endif // SIM_TRANSFORM2_HPP
@@ -9,25 +9,53 @@
 //  - constexpr/noexcept everywhere for performance
 //  - No dependencies - can be used anywhere in the project
 //  - Dimensionless: can represent position, velocity, force, etc.
+//  - Templated on the component type; Vec2 (double) is what the engine
+//    uses. Other NumberLike types, e.g. Dual<N> from dual.hpp, give the
+//    same vector code with derivatives carried along
 
 #include "../core/concepts.hpp"  // Get Scalar concept from here
 #include <cmath>      // std::sqrt
 #include <compare>    // std::strong_ordering
+#include <concepts>   // std::floating_point, std::integral, std::same_as
 
 namespace sim {
 
+/// Factor types a BasicVec2<T> can be scaled by: built-in scalars or T.
+/// Integer vectors take integer factors only
+template<typename S, typename T>
+concept VecFactor = std::same_as<S, T> || (Scalar<S> && !(std::integral<T> && std::floating_point<S>));
+
+namespace detail {
+
+/// A factor in the components' own type when they are built-in, so
+/// BasicVec2<float> * 2.0 stays float instead of narrowing a double into
+/// the braced result; class types (Dual, Checked) keep their scalar overloads
+template<typename T, typename S>
+[[nodiscard]] constexpr auto vec_factor(S s) noexcept {
+  if constexpr (Scalar<T>) {
+    return static_cast<T>(s);
+  } else {
+    return s;
+  }
+}
+
+} // namespace detail
+
 // -----------------------------
 // 2D Vector
 // -----------------------------
-struct Vec2 {
-  double x{0.0};
-  double y{0.0};
+template<NumberLike T>
+struct BasicVec2 {
+  using Vec2 = BasicVec2;   // lets the member definitions keep their names
+
+  T x{0.0};
+  T y{0.0};
 
   // ─────────────────────────────────────────────────────────────
   // Constructors
   // ─────────────────────────────────────────────────────────────
-  constexpr Vec2() noexcept = default;
-  constexpr Vec2(double x_, double y_) noexcept : x(x_), y(y_) {}
+  constexpr BasicVec2() noexcept = default;
+  constexpr BasicVec2(T x_, T y_) noexcept : x(x_), y(y_) {}
 
   // ─────────────────────────────────────────────────────────────
   // Arithmetic operators
@@ -40,12 +68,16 @@ struct Vec2 {
     return Vec2{x - o.x, y - o.y}; 
   }
   
-  [[nodiscard]] constexpr Vec2 operator*(Scalar auto s) const noexcept { 
-    return Vec2{x * s, y * s}; 
+  template<VecFactor<T> S>
+  [[nodiscard]] constexpr Vec2 operator*(S s) const noexcept { 
+    const auto f = detail::vec_factor<T>(s);
+    return Vec2{x * f, y * f};
   }
   
-  [[nodiscard]] constexpr Vec2 operator/(Scalar auto s) const noexcept { 
-    return Vec2{x / s, y / s}; 
+  template<VecFactor<T> S>
+  [[nodiscard]] constexpr Vec2 operator/(S s) const noexcept { 
+    const auto f = detail::vec_factor<T>(s);
+    return Vec2{x / f, y / f};
   }
   
   [[nodiscard]] constexpr Vec2 operator-() const noexcept { 
@@ -67,15 +99,19 @@ struct Vec2 {
     return *this; 
   }
   
-  constexpr Vec2& operator*=(Scalar auto s) noexcept { 
-    x *= s; 
-    y *= s; 
+  template<VecFactor<T> S>
+  constexpr Vec2& operator*=(S s) noexcept { 
+    const auto f = detail::vec_factor<T>(s);
+    x *= f;
+    y *= f;
     return *this; 
   }
   
-  constexpr Vec2& operator/=(Scalar auto s) noexcept { 
-    x /= s; 
-    y /= s; 
+  template<VecFactor<T> S>
+  constexpr Vec2& operator/=(S s) noexcept { 
+    const auto f = detail::vec_factor<T>(s);
+    x /= f;
+    y /= f;
     return *this; 
   }
 
@@ -90,7 +126,7 @@ struct Vec2 {
   // ─────────────────────────────────────────────────────────────
   
   /// Dot product: measures alignment between vectors
-  [[nodiscard]] constexpr double dot(const Vec2& o) const noexcept { 
+  [[nodiscard]] constexpr T dot(const Vec2& o) const noexcept { 
     return x * o.x + y * o.y; 
   }
   
@@ -98,34 +134,35 @@ struct Vec2 {
   /// Result > 0: o is counter-clockwise from this
   /// Result < 0: o is clockwise from this
   /// Result = 0: vectors are parallel
-  [[nodiscard]] constexpr double cross(const Vec2& o) const noexcept { 
+  [[nodiscard]] constexpr T cross(const Vec2& o) const noexcept { 
     return x * o.y - y * o.x;
   }
 
   /// Euclidean length (magnitude) of the vector
-  [[nodiscard]] double length() const noexcept { 
-    return std::sqrt(x * x + y * y); 
+  [[nodiscard]] T length() const noexcept { 
+    using std::sqrt;   // number-like types provide sqrt found by ADL
+    return sqrt(x * x + y * y); 
   }
   
   /// Squared length - faster than length() when you only need comparisons
-  [[nodiscard]] constexpr double length_sq() const noexcept { 
+  [[nodiscard]] constexpr T length_sq() const noexcept { 
     return x * x + y * y; 
   }
 
   /// Returns unit vector in same direction (length = 1)
   /// Returns zero vector if length is zero (avoids division by zero)
   [[nodiscard]] Vec2 normalized() const noexcept {
-    const double len = length();
-    return len > 0.0 ? *this / len : Vec2{};
+    const T len = length();
+    return len > T{0.0} ? *this / len : Vec2{};
   }
 
   /// Euclidean distance to another vector
-  [[nodiscard]] double distance_to(const Vec2& o) const noexcept {
+  [[nodiscard]] T distance_to(const Vec2& o) const noexcept {
     return (*this - o).length();
   }
 
   /// Squared distance - faster for comparisons
-  [[nodiscard]] constexpr double distance_sq_to(const Vec2& o) const noexcept {
+  [[nodiscard]] constexpr T distance_sq_to(const Vec2& o) const noexcept {
     return (*this - o).length_sq();
   }
 
@@ -136,7 +173,7 @@ struct Vec2 {
   
   /// Linear interpolation between this and another vector
   /// t=0 returns this, t=1 returns o
-  [[nodiscard]] constexpr Vec2 lerp(const Vec2& o, double t) const noexcept {
+  [[nodiscard]] constexpr Vec2 lerp(const Vec2& o, T t) const noexcept {
     return *this + (o - *this) * t;
   }
 };
@@ -146,10 +183,14 @@ struct Vec2 {
 // ─────────────────────────────────────────────────────────────
 
 /// Allow scalar * vector (in addition to vector * scalar)
-[[nodiscard]] constexpr Vec2 operator*(Scalar auto s, const Vec2& v) noexcept { 
-  return Vec2{v.x * s, v.y * s}; 
+template<typename T, VecFactor<T> S>
+[[nodiscard]] constexpr BasicVec2<T> operator*(S s, const BasicVec2<T>& v) noexcept { 
+  return v * s;
 }
 
+/// The engine's vector type
+using Vec2 = BasicVec2<double>;
+
 } // namespace sim
 
 #endif // SIM_VEC2_HPP
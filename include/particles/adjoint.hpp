@@ -0,0 +1,308 @@
+#pragma once
+#ifndef SIM_ADJOINT_HPP
+#define SIM_ADJOINT_HPP
+// include/particles/adjoint.hpp
+// Differentiable particle stepping: forward kernel, hand-written adjoint
+// kernel, and a checkpointed reverse pass that returns gradients of a
+// rollout loss with respect to the initial state and all parameters
+//
+// Design notes:
+//  - Model: semi-implicit Euler with smooth force laws only (gravity,
+//    linear drag, Hookean springs). Contacts and clamps are left out on
+//    purpose; their gradients are not useful for optimisation
+//  - The adjoint of a step needs only the state the step started from,
+//    so the reverse pass never stores intermediate forces, just states
+//  - Checkpointing follows the binomial (revolve) schedule: with s
+//    snapshot slots a rollout of n <= C(s + t, t) steps is reversed with
+//    each step recomputed at most t times. Memory is s states regardless
+//    of n; s >= n degenerates to store-everything
+//  - Parameter gradients have the same layout as the parameters
+//    (DiffParams), state gradients the same layout as states (DiffState)
+//  - State, parameters and diff_step are templated on the scalar: with
+//    Dual<N> (math/dual.hpp) the same kernel gives forward-mode
+//    sensitivities, e.g. to cross-check the adjoint or when there are
+//    fewer inputs than outputs
+
+#include "../math/vec2.hpp"
+#include <algorithm>  // std::max, std::min
+#include <cmath>      // std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+struct Spring {
+  std::uint32_t a{0};
+  std::uint32_t b{0};
+};
+
+/// Topology and constants that are not differentiated
+struct DiffModel {
+  std::vector<double> inv_mass;    ///< one per particle; 0 pins a particle
+  std::vector<Spring> springs;
+
+  [[nodiscard]] std::size_t particles() const noexcept { return inv_mass.size(); }
+};
+
+/// Differentiable parameters (also the layout of their gradient)
+template<NumberLike T>
+struct BasicDiffParams {
+  BasicVec2<T> gravity{0.0, -9.81};
+  T drag{0.0};                  ///< acceleration -drag * v
+  std::vector<T> stiffness;     ///< per spring
+  std::vector<T> rest_length;   ///< per spring
+
+  /// Zeroed copy with the same shape, for accumulating gradients
+  [[nodiscard]] BasicDiffParams zeros_like() const {
+    BasicDiffParams z;
+    z.gravity = BasicVec2<T>{};
+    z.stiffness.assign(stiffness.size(), T{0.0});
+    z.rest_length.assign(rest_length.size(), T{0.0});
+    return z;
+  }
+};
+
+/// Particle positions and velocities (also the layout of their gradient)
+template<NumberLike T>
+struct BasicDiffState {
+  std::vector<T> x, y, vx, vy;
+
+  BasicDiffState() = default;
+  explicit BasicDiffState(std::size_t n)
+      : x(n, T{0.0}), y(n, T{0.0}), vx(n, T{0.0}), vy(n, T{0.0}) {}
+
+  [[nodiscard]] std::size_t size() const noexcept { return x.size(); }
+};
+
+using DiffParams = BasicDiffParams<double>;
+using DiffState = BasicDiffState<double>;
+
+// ─────────────────────────────────────────────────────────────
+// Kernels
+// ─────────────────────────────────────────────────────────────
+
+/// One step: v' = v + dt * a(x, v), x' = x + dt * v'. out must be sized;
+/// it may not alias in.
+template<NumberLike T>
+void diff_step(const DiffModel& model, const BasicDiffParams<T>& p, const BasicDiffState<T>& in,
+               BasicDiffState<T>& out, double dt) noexcept {
+  using std::sqrt;   // Dual<N> provides its own, found by ADL
+  const std::size_t n = model.particles();
+  for (std::size_t i = 0; i < n; ++i) {
+    const double w = model.inv_mass[i];
+    const double g = w > 0.0 ? 1.0 : 0.0;
+    out.vx[i] = g * (p.gravity.x - p.drag * in.vx[i]);
+    out.vy[i] = g * (p.gravity.y - p.drag * in.vy[i]);
+  }
+  // Spring accelerations, accumulated into out.v before the update
+  for (std::size_t s = 0; s < model.springs.size(); ++s) {
+    const Spring& sp = model.springs[s];
+    const T dx = in.x[sp.a] - in.x[sp.b];
+    const T dy = in.y[sp.a] - in.y[sp.b];
+    const T len = sqrt(dx * dx + dy * dy);
+    if (len == 0.0) continue;
+    const T f = -p.stiffness[s] * (len - p.rest_length[s]) / len;
+    out.vx[sp.a] += model.inv_mass[sp.a] * f * dx;
+    out.vy[sp.a] += model.inv_mass[sp.a] * f * dy;
+    out.vx[sp.b] -= model.inv_mass[sp.b] * f * dx;
+    out.vy[sp.b] -= model.inv_mass[sp.b] * f * dy;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    out.vx[i] = in.vx[i] + dt * out.vx[i];
+    out.vy[i] = in.vy[i] + dt * out.vy[i];
+    out.x[i] = in.x[i] + dt * out.vx[i];
+    out.y[i] = in.y[i] + dt * out.vy[i];
+  }
+}
+
+/// Adjoint of diff_step taken from state `in`: on entry adj holds dL/d(out),
+/// on return dL/d(in). Parameter gradients are added to grad.
+inline void diff_step_adjoint(const DiffModel& model, const DiffParams& p, const DiffState& in,
+                              DiffState& adj, DiffParams& grad, double dt) noexcept {
+  const std::size_t n = model.particles();
+  // x' = x + dt v' feeds v': mu = dt * dL/dv' (total) is the adjoint of
+  // the acceleration
+  for (std::size_t i = 0; i < n; ++i) {
+    adj.vx[i] += dt * adj.x[i];
+    adj.vy[i] += dt * adj.y[i];
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (model.inv_mass[i] <= 0.0) continue;
+    const double mx = dt * adj.vx[i];
+    const double my = dt * adj.vy[i];
+    grad.gravity.x += mx;
+    grad.gravity.y += my;
+    grad.drag -= mx * in.vx[i] + my * in.vy[i];
+  }
+  for (std::size_t s = 0; s < model.springs.size(); ++s) {
+    const Spring& sp = model.springs[s];
+    const double dx = in.x[sp.a] - in.x[sp.b];
+    const double dy = in.y[sp.a] - in.y[sp.b];
+    const double len = std::sqrt(dx * dx + dy * dy);
+    if (len == 0.0) continue;
+    const double ux = dx / len, uy = dy / len;
+    const double k = p.stiffness[s];
+    const double stretch = len - p.rest_length[s];
+    // q: adjoint seen by the spring force f (on a; -f on b)
+    const double wa = model.inv_mass[sp.a], wb = model.inv_mass[sp.b];
+    const double qx = dt * (wa * adj.vx[sp.a] - wb * adj.vx[sp.b]);
+    const double qy = dt * (wa * adj.vy[sp.a] - wb * adj.vy[sp.b]);
+    // df/dx_a = -K with K = k (u u^T + stretch/len (I - u u^T)), symmetric
+    const double qu = qx * ux + qy * uy;
+    const double t = stretch / len;
+    const double kqx = k * (qu * ux + t * (qx - qu * ux));
+    const double kqy = k * (qu * uy + t * (qy - qu * uy));
+    adj.x[sp.a] -= kqx;
+    adj.y[sp.a] -= kqy;
+    adj.x[sp.b] += kqx;
+    adj.y[sp.b] += kqy;
+    grad.stiffness[s] -= stretch * qu;
+    grad.rest_length[s] += k * qu;
+  }
+  // Drag: a = -drag v, so dL/dv gets -drag * mu for moving particles
+  for (std::size_t i = 0; i < n; ++i) {
+    if (model.inv_mass[i] <= 0.0) continue;
+    adj.vx[i] -= p.drag * dt * adj.vx[i];
+    adj.vy[i] -= p.drag * dt * adj.vy[i];
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Checkpointed Rollout
+// ─────────────────────────────────────────────────────────────
+
+/// Running-loss hook that adds nothing
+struct NoRunningLoss {
+  void operator()(std::size_t, const DiffState&, DiffState&) const noexcept {}
+};
+
+struct CheckpointStats {
+  std::uint64_t forward_steps{0};     ///< including recomputation
+  std::uint64_t adjoint_steps{0};
+  std::size_t max_snapshots{0};       ///< peak snapshot slots in use
+};
+
+class AdjointRollout {
+public:
+  /// steps: rollout length; snapshots: state slots the reverse pass may hold
+  AdjointRollout(const DiffModel& model, double dt, std::size_t steps, std::size_t snapshots)
+      : model_(model), dt_(dt), steps_(steps),
+        snapshots_(snapshots, DiffState(model.particles())),
+        initial_(model.particles()), final_(model.particles()),
+        scratch_a_(model.particles()), scratch_b_(model.particles()),
+        scratch_c_(model.particles()) {}
+
+  /// Run the rollout; keeps the initial state and parameters for backward()
+  const DiffState& forward(const DiffState& initial, const DiffParams& params) {
+    initial_ = initial;
+    params_ = params;
+    stats_ = CheckpointStats{};
+    advance(initial_, steps_, final_);
+    return final_;
+  }
+
+  /// Reverse pass after forward(). final_grad is dL/d(final state);
+  /// running(k, state_k, adj) may add dL/d(state_k) for a trajectory loss
+  /// (it is called for every k from steps down to 0). Gradients are
+  /// written to initial_grad and param_grad.
+  template<typename Running = NoRunningLoss>
+  void backward(const DiffState& final_grad, DiffState& initial_grad, DiffParams& param_grad,
+                Running&& running = {}) {
+    initial_grad = final_grad;
+    param_grad = params_.zeros_like();
+    running(steps_, std::as_const(final_), initial_grad);
+    used_ = 0;
+    reverse(initial_, 0, steps_, snapshots_.size(), initial_grad, param_grad, running);
+  }
+
+  [[nodiscard]] const DiffState& final_state() const noexcept { return final_; }
+  [[nodiscard]] const CheckpointStats& stats() const noexcept { return stats_; }
+  [[nodiscard]] std::size_t steps() const noexcept { return steps_; }
+
+  /// C(s + t, t), saturating: steps reversible with s slots and t repeats
+  [[nodiscard]] static std::size_t binomial_capacity(std::size_t s, std::size_t t) noexcept {
+    std::size_t r = 1;
+    for (std::size_t i = 1; i <= t; ++i) {
+      // r * (s + i) / i stays integral at every step
+      if (r > std::numeric_limits<std::size_t>::max() / (s + i)) {
+        return std::numeric_limits<std::size_t>::max();
+      }
+      r = r * (s + i) / i;
+    }
+    return r;
+  }
+
+private:
+  /// Step `from` forward n times into out (n == 0 copies)
+  void advance(const DiffState& from, std::size_t n, DiffState& out) {
+    if (n == 0) {
+      out = from;
+      return;
+    }
+    const DiffState* src = &from;
+    for (std::size_t k = 0; k < n; ++k) {
+      DiffState& dst = k + 1 == n ? out : (k % 2 == 0 ? scratch_a_ : scratch_b_);
+      diff_step(model_, params_, *src, dst, dt_);
+      src = &dst;
+    }
+    stats_.forward_steps += n;
+  }
+
+  /// Reverse steps [k0, k0 + n) starting from `start` = state k0 with
+  /// `slots` free snapshot slots. adj: dL/d(state k0 + n) in, dL/d(state k0) out.
+  template<typename Running>
+  void reverse(const DiffState& start, std::size_t k0, std::size_t n, std::size_t slots,
+               DiffState& adj, DiffParams& grad, Running& running) {
+    if (n == 0) return;
+    if (n == 1) {
+      adjoint(start, k0, adj, grad, running);
+      return;
+    }
+    if (slots == 0) {
+      // No room: recompute every state from start (quadratic, but bounded memory)
+      for (std::size_t i = n; i-- > 0;) {
+        advance(start, i, scratch_c_);
+        adjoint(scratch_c_, k0 + i, adj, grad, running);
+      }
+      return;
+    }
+    // Smallest repeat count t with C(slots + t, t) >= n, then split so the
+    // right part fits C(slots - 1 + t, t) and the left C(slots + t - 1, t - 1)
+    std::size_t t = 1;
+    while (binomial_capacity(slots, t) < n) ++t;
+    const std::size_t right = std::min(binomial_capacity(slots - 1, t), n - 1);
+    const std::size_t m = n - right;
+
+    DiffState& snap = snapshots_[used_++];
+    stats_.max_snapshots = std::max(stats_.max_snapshots, used_);
+    advance(start, m, snap);
+    reverse(snap, k0 + m, right, slots - 1, adj, grad, running);
+    --used_;
+    reverse(start, k0, m, slots, adj, grad, running);
+  }
+
+  template<typename Running>
+  void adjoint(const DiffState& state, std::size_t k, DiffState& adj, DiffParams& grad,
+               Running& running) {
+    diff_step_adjoint(model_, params_, state, adj, grad, dt_);
+    ++stats_.adjoint_steps;
+    running(k, state, adj);
+  }
+
+  DiffModel model_;
+  DiffParams params_;
+  double dt_;
+  std::size_t steps_;
+  std::vector<DiffState> snapshots_;
+  std::size_t used_{0};
+  DiffState initial_, final_;
+  DiffState scratch_a_, scratch_b_, scratch_c_;
+  CheckpointStats stats_;
+};
+
+} // namespace sim
+
+#endif // SIM_ADJOINT_HPP
@@ -0,0 +1,136 @@
+#pragma once
+#ifndef SIM_CURL_NOISE_CACHE_HPP
+#define SIM_CURL_NOISE_CACHE_HPP
+// include/particles/curl_noise_cache.hpp
+// Curl-noise velocities baked on a coarse lattice, refreshed at a lower
+// rate than the simulation and sampled bilinearly
+//
+// Design notes:
+//  - Noise cost becomes (lattice nodes / refresh interval) instead of
+//    (particles * octaves) per step; sampling is four loads and a lerp
+//  - Bilinear interpolation of a divergence-free field is only
+//    approximately divergence-free; the error shrinks with the spacing
+//  - Points outside the region are clamped to its border
+//  - sample_batch is branch-free with int32 lattice indices, so it
+//    vectorises with gathers (AVX2 and newer)
+
+#include "../collision/aabb.hpp"
+#include "../math/noise.hpp"
+#include <algorithm>  // std::fill, std::max, std::min
+#include <cmath>      // std::ceil, std::isfinite
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Curl Noise Cache
+// -----------------------------
+class CurlNoiseCache {
+public:
+  CurlNoiseCache(const AABB& region, double spacing, const CurlNoiseParams& params,
+                 double update_interval)
+    : params_(params), origin_(region.lower), spacing_(spacing), inv_spacing_(1.0 / spacing),
+      interval_(update_interval) {
+    const Vec2 size = region.upper - region.lower;
+    // At least 2 x 2 nodes, so a degenerate region still has one cell
+    nx_ = std::max(static_cast<int>(std::ceil(size.x * inv_spacing_)) + 1, 2);
+    ny_ = std::max(static_cast<int>(std::ceil(size.y * inv_spacing_)) + 1, 2);
+    const std::size_t nodes = static_cast<std::size_t>(nx_) * static_cast<std::size_t>(ny_);
+    node_x_.resize(nodes);
+    node_y_.resize(nodes);
+    vx_.assign(nodes, 0.0);
+    vy_.assign(nodes, 0.0);
+    for (int j = 0; j < ny_; ++j) {
+      for (int i = 0; i < nx_; ++i) {
+        node_x_[index(i, j)] = origin_.x + i * spacing_;
+        node_y_[index(i, j)] = origin_.y + j * spacing_;
+      }
+    }
+  }
+
+  /// Re-bake the lattice if update_interval has elapsed since the last
+  /// bake. The pattern scrolls with scroll_velocity. Returns true when
+  /// the lattice was refreshed.
+  bool update(double time, const Vec2& scroll_velocity = {}) {
+    if (baked_ && time - baked_time_ < interval_) return false;
+    std::fill(vx_.begin(), vx_.end(), 0.0);
+    std::fill(vy_.begin(), vy_.end(), 0.0);
+    curl_noise_batch(node_x_.data(), node_y_.data(), node_x_.size(), params_,
+                     scroll_velocity * time, 1.0, vx_.data(), vy_.data());
+    baked_ = true;
+    baked_time_ = time;
+    ++refreshes_;
+    return true;
+  }
+
+  [[nodiscard]] Vec2 sample(const Vec2& p) const noexcept {
+    double vx = 0.0;
+    double vy = 0.0;
+    sample_batch(&p.x, &p.y, 1, 1.0, &vx, &vy);
+    return Vec2{vx, vy};
+  }
+
+  /// Add scale * cached velocity to (vx, vy) for n points. The outputs
+  /// must not overlap the inputs. Non-finite points get nothing added,
+  /// as ParticleGrid skips them, and never index outside the lattice
+  void sample_batch(const double* __restrict x, const double* __restrict y, std::size_t n,
+                    double scale, double* __restrict vx, double* __restrict vy) const noexcept {
+    const double max_u = nx_ - 1.000001;
+    const double max_v = ny_ - 1.000001;
+    const double ox = origin_.x;
+    const double oy = origin_.y;
+    const double inv = inv_spacing_;
+    const std::int32_t nx = nx_;
+    const double* __restrict node_vx = vx_.data();
+    const double* __restrict node_vy = vy_.data();
+    for (std::size_t k = 0; k < n; ++k) {
+      const double weight = scale * static_cast<double>(std::isfinite(x[k]) & std::isfinite(y[k]));
+      // max(0.0, NaN) is 0.0: the argument order matters
+      const double u = std::min(std::max(0.0, (x[k] - ox) * inv), max_u);
+      const double v = std::min(std::max(0.0, (y[k] - oy) * inv), max_v);
+      const auto iu = static_cast<std::int32_t>(u);   // u, v >= 0: truncation is floor
+      const auto iv = static_cast<std::int32_t>(v);
+      const double tu = u - iu;
+      const double tv = v - iv;
+      const std::int32_t i00 = iv * nx + iu;
+      const std::int32_t i10 = i00 + 1;
+      const std::int32_t i01 = i00 + nx;
+      const std::int32_t i11 = i01 + 1;
+      const double w00 = (1.0 - tu) * (1.0 - tv);
+      const double w10 = tu * (1.0 - tv);
+      const double w01 = (1.0 - tu) * tv;
+      const double w11 = tu * tv;
+      vx[k] += weight * (w00 * node_vx[i00] + w10 * node_vx[i10] + w01 * node_vx[i01] + w11 * node_vx[i11]);
+      vy[k] += weight * (w00 * node_vy[i00] + w10 * node_vy[i10] + w01 * node_vy[i01] + w11 * node_vy[i11]);
+    }
+  }
+
+  [[nodiscard]] std::size_t node_count() const noexcept { return node_x_.size(); }
+  [[nodiscard]] std::uint64_t refreshes() const noexcept { return refreshes_; }
+  [[nodiscard]] const CurlNoiseParams& params() const noexcept { return params_; }
+
+private:
+  [[nodiscard]] std::size_t index(int i, int j) const noexcept {
+    return static_cast<std::size_t>(j) * static_cast<std::size_t>(nx_) + static_cast<std::size_t>(i);
+  }
+
+  CurlNoiseParams params_;
+  Vec2 origin_;
+  double spacing_;
+  double inv_spacing_;
+  double interval_;
+  int nx_{0};
+  int ny_{0};
+
+  std::vector<double> node_x_, node_y_;
+  std::vector<double> vx_, vy_;
+  bool baked_{false};
+  double baked_time_{0.0};
+  std::uint64_t refreshes_{0};
+};
+
+} // namespace sim
+
+#endif // SIM_CURL_NOISE_CACHE_HPP
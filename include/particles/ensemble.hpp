@@ -0,0 +1,287 @@
+#pragma once
+#ifndef SIM_ENSEMBLE_HPP
+#define SIM_ENSEMBLE_HPP
+// include/particles/ensemble.hpp
+// Many small independent worlds in one process: a self-contained
+// particle box world, an ensemble that steps worlds as parallel jobs, and
+// a parameter sweep that collects one summary per world
+//
+// Design notes:
+//  - The unit of work is a whole world, not a phase: each job runs all
+//    requested steps of one world, so there is no barrier per step and a
+//    ~1k particle world stays in the worker's cache while it runs
+//  - Worlds share nothing (own grid, own RNG seed), so results do not
+//    depend on the thread count or on which worker ran which world
+//  - run_sweep() builds, runs, summarises and drops each world inside its
+//    job: memory is bounded by the worker count, not the sweep size
+//  - Any type with step(double) can be an ensemble member (EnsembleWorld)
+//  - With SIM_FP_VALIDATION on, ParticleWorld::step() scans its state
+//    after each phase and reports the first non-finite value by step,
+//    phase and particle (id = the world's seed). The world then halts,
+//    keeping the state as it was found; the rest of the ensemble goes on
+//  - Without validation a NaN world keeps stepping (the grid leaves
+//    non-finite particles out), and its summary has finite == false
+
+#include "particle_grid.hpp"
+#include "particle_store.hpp"
+#include "soft_disc.hpp"
+#include "../collision/aabb.hpp"
+#include "../core/parallel_for.hpp"
+#include "../debug/fp_validation.hpp"
+#include <algorithm>  // std::max, std::min
+#include <cmath>      // std::isfinite, std::sqrt
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+template<typename W>
+concept EnsembleWorld = requires(W& w, double dt) { w.step(dt); };
+
+// -----------------------------
+// Particle World
+// -----------------------------
+struct ParticleWorldParams : SoftDiscParams {
+  Vec2 gravity{0.0, -9.81};
+};
+
+/// Soft-disc particles in a box: grid neighbour repulsion, gravity, walls
+class ParticleWorld {
+public:
+  explicit ParticleWorld(const ParticleWorldParams& params = {})
+      : params_(params), grid_(2.0 * params.radius) {
+    reset(params.seed);
+  }
+
+  /// Re-seed the initial state (same params, new random layout)
+  void reset(std::uint32_t seed) {
+    params_.seed = seed;
+    ps_.clear();
+    ps_.reserve(params_.particles);
+    generate_soft_discs(params_, seed, [this](std::size_t, const Vec2& p, const Vec2& v) {
+      ps_.add(p, v, 1.0);
+    });
+    time_ = 0.0;
+    steps_ = 0;
+    contacts_ = 0;
+    fp_ok_ = true;
+  }
+
+  /// No-op once halted()
+  void step(double dt) {
+    if (!fp_ok_) return;
+    const FpStepScope fp_step(steps_, params_.seed);
+    accumulate_pair_forces();
+    // Once a value went bad it spreads; only its first appearance is reported
+    fp_ok_ = fp_ok_ && fp_check_finite("pair_forces", ps_.fx, ps_.fy);
+    integrate_particles(ps_, params_.gravity, dt);
+    fp_ok_ = fp_ok_ && fp_check_finite("integrate", ps_.x, ps_.y, ps_.vx, ps_.vy);
+    confine();
+    time_ += dt;
+    ++steps_;
+  }
+
+  [[nodiscard]] const ParticleStore& particles() const noexcept { return ps_; }
+  [[nodiscard]] ParticleStore& particles() noexcept { return ps_; }
+  [[nodiscard]] const ParticleWorldParams& params() const noexcept { return params_; }
+  [[nodiscard]] double time() const noexcept { return time_; }
+  [[nodiscard]] std::uint64_t steps() const noexcept { return steps_; }
+  /// Overlapping pairs found in the last step (each pair counted once)
+  [[nodiscard]] std::size_t contacts() const noexcept { return contacts_; }
+  /// Stopped by a validation report (always false without SIM_FP_VALIDATION)
+  [[nodiscard]] bool halted() const noexcept { return !fp_ok_; }
+
+private:
+  void accumulate_pair_forces() {
+    const std::size_t n = ps_.size();
+    grid_.build(ps_.x, ps_.y);
+    const double d = 2.0 * params_.radius;
+    const Vec2 reach{d, d};
+    std::size_t pairs = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      // Each particle gathers its own force, so the loop order (and any
+      // later split of it) cannot change the result
+      const double xi = ps_.x[i], yi = ps_.y[i];
+      double fx = 0.0, fy = 0.0;
+      grid_.for_each_span(AABB{Vec2{xi, yi} - reach, Vec2{xi, yi} + reach},
+                          [&](std::span<const std::uint32_t> span) {
+        for (const std::uint32_t j : span) {
+          if (j == i) continue;
+          const double dx = xi - ps_.x[j];
+          const double dy = yi - ps_.y[j];
+          const double d2 = dx * dx + dy * dy;
+          if (d2 >= d * d || d2 == 0.0) continue;
+          const double dist = std::sqrt(d2);
+          const double nx = dx / dist, ny = dy / dist;
+          const double vn = (ps_.vx[i] - ps_.vx[j]) * nx + (ps_.vy[i] - ps_.vy[j]) * ny;
+          const double f = soft_disc_force(params_, dist, vn);
+          fx += f * nx;
+          fy += f * ny;
+          if (j > i) ++pairs;
+        }
+      });
+      ps_.fx[i] += fx;
+      ps_.fy[i] += fy;
+    }
+    contacts_ = pairs;
+  }
+
+  void confine() noexcept {
+    const AABB& b = params_.box;
+    const double r = params_.radius;
+    const double e = params_.restitution;
+    for (std::size_t i = 0; i < ps_.size(); ++i) {
+      confine_soft_disc_axis(ps_.x[i], ps_.vx[i], b.lower.x + r, b.upper.x - r, e);
+      confine_soft_disc_axis(ps_.y[i], ps_.vy[i], b.lower.y + r, b.upper.y - r, e);
+    }
+  }
+
+  ParticleWorldParams params_;
+  ParticleStore ps_;
+  ParticleGrid grid_;
+  double time_{0.0};
+  std::uint64_t steps_{0};
+  std::size_t contacts_{0};
+  bool fp_ok_{true};     ///< no non-finite state reported yet; false halts the world
+};
+
+/// Per-world output of a run
+struct WorldSummary {
+  std::uint32_t seed{0};
+  std::uint64_t steps{0};
+  double kinetic_energy{0.0};
+  Vec2 center_of_mass{};
+  double max_speed{0.0};
+  std::size_t contacts{0};
+  bool finite{true};      ///< no NaN/Inf in the final positions and velocities
+  bool halted{false};     ///< stopped early by FP validation (steps says when)
+};
+
+[[nodiscard]] inline WorldSummary summarize_world(const ParticleWorld& world) noexcept {
+  const ParticleStore& ps = world.particles();
+  WorldSummary s;
+  s.seed = world.params().seed;
+  s.steps = world.steps();
+  s.contacts = world.contacts();
+  s.halted = world.halted();
+  double mass = 0.0;
+  double max_v2 = 0.0;
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    s.finite = s.finite && std::isfinite(ps.x[i]) && std::isfinite(ps.y[i]) &&
+               std::isfinite(ps.vx[i]) && std::isfinite(ps.vy[i]);
+    if (ps.inv_mass[i] == 0.0) continue;
+    const double m = 1.0 / ps.inv_mass[i];
+    const double v2 = ps.vx[i] * ps.vx[i] + ps.vy[i] * ps.vy[i];
+    s.kinetic_energy += 0.5 * m * v2;
+    s.center_of_mass += ps.position(i) * m;
+    mass += m;
+    max_v2 = std::max(max_v2, v2);
+  }
+  if (mass > 0.0) s.center_of_mass = s.center_of_mass / mass;
+  s.max_speed = std::sqrt(max_v2);
+  return s;
+}
+
+// -----------------------------
+// Ensemble
+// -----------------------------
+struct EnsembleStats {
+  std::size_t worlds{0};
+  std::uint64_t world_steps{0};     ///< summed over worlds and runs
+};
+
+/// Independent worlds stepped as one job per world
+template<EnsembleWorld World>
+class Ensemble {
+public:
+  /// pool == nullptr runs every world on the calling thread
+  explicit Ensemble(TaskPool* pool = nullptr) : pool_(pool) {}
+
+  template<typename... Args>
+  World& emplace(Args&&... args) {
+    return worlds_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  /// Advance every world by `steps` fixed steps
+  void run(std::size_t steps, double dt) {
+    parallel_for(pool_, worlds_.size(), [&](std::size_t w) {
+      World& world = worlds_[w];
+      for (std::size_t s = 0; s < steps; ++s) world.step(dt);
+    });
+    stats_.world_steps += static_cast<std::uint64_t>(steps) * worlds_.size();
+  }
+
+  /// fn(world, index) for every world, one job per world
+  template<typename Fn>
+  void for_each(Fn&& fn) {
+    parallel_for(pool_, worlds_.size(), [this, &fn](std::size_t w) { fn(worlds_[w], w); });
+  }
+
+  /// fn(world) for every world, results in world order
+  template<typename Fn>
+  [[nodiscard]] auto collect(Fn&& fn) const {
+    using Result = std::invoke_result_t<Fn&, const World&>;
+    std::vector<Result> out(worlds_.size());
+    parallel_for(pool_, worlds_.size(), [&](std::size_t w) { out[w] = fn(worlds_[w]); });
+    return out;
+  }
+
+  [[nodiscard]] World& world(std::size_t i) noexcept { return worlds_[i]; }
+  [[nodiscard]] const World& world(std::size_t i) const noexcept { return worlds_[i]; }
+  [[nodiscard]] std::span<World> worlds() noexcept { return worlds_; }
+  [[nodiscard]] std::size_t size() const noexcept { return worlds_.size(); }
+  [[nodiscard]] TaskPool* pool() const noexcept { return pool_; }
+
+  [[nodiscard]] EnsembleStats stats() const noexcept {
+    EnsembleStats s = stats_;
+    s.worlds = worlds_.size();
+    return s;
+  }
+
+  void clear() noexcept { worlds_.clear(); }
+
+private:
+  TaskPool* pool_;
+  std::vector<World> worlds_;
+  EnsembleStats stats_;
+};
+
+// ─────────────────────────────────────────────────────────────
+// Parameter Sweeps
+// ─────────────────────────────────────────────────────────────
+
+/// count copies of base with seeds base.seed, base.seed + stride, ...
+/// Use stride = Lanes for LaneWorldBatch, whose lanes take seed + lane.
+template<typename Params>
+[[nodiscard]] std::vector<Params> seed_sweep(const Params& base, std::size_t count,
+                                             std::uint32_t stride = 1) {
+  std::vector<Params> out(count, base);
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i].seed = base.seed + static_cast<std::uint32_t>(i) * stride;
+  }
+  return out;
+}
+
+/// Build a World from each parameter set, run it for `steps` steps and
+/// keep only summarize(world). Results are in parameter order.
+template<EnsembleWorld World, typename Params, typename Summarize>
+[[nodiscard]] auto run_sweep(TaskPool* pool, std::span<const Params> params, std::size_t steps,
+                             double dt, Summarize&& summarize) {
+  using Result = std::invoke_result_t<Summarize&, const World&>;
+  std::vector<Result> out(params.size());
+  parallel_for(pool, params.size(), [&](std::size_t i) {
+    World world(params[i]);
+    for (std::size_t s = 0; s < steps; ++s) world.step(dt);
+    out[i] = summarize(std::as_const(world));
+  });
+  return out;
+}
+
+} // namespace sim
+
+#endif // SIM_ENSEMBLE_HPP
@@ -0,0 +1,63 @@
+#pragma once
+#ifndef SIM_PARTICLE_COLLISION_HPP
+#define SIM_PARTICLE_COLLISION_HPP
+// include/particles/particle_collision.hpp
+// Particles (as small circles) against static colliders
+//
+// Design notes:
+//  - Position projection plus a velocity response: the normal component
+//    is reflected by the pair restitution, the tangential one is reduced
+//    by Coulomb friction against the normal velocity change
+//  - The material pair comes from one MaterialTable lookup per contact
+//  - Sensors are skipped; they never generate contacts
+
+#include "particle_store.hpp"
+#include "../collision/collider.hpp"
+#include <algorithm>  // std::max
+
+namespace sim {
+
+/// Resolve every particle against the colliders in the scene.
+/// Returns the number of contacts handled.
+inline std::size_t collide_particles(ParticleStore& ps, const CollisionScene& scene,
+                                     const MaterialTable& materials, double radius) {
+  const ConvexProxy dot = make_circle(Vec2{}, radius);
+  const Vec2 r{radius, radius};
+  std::size_t contacts = 0;
+
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    if (ps.inv_mass[i] == 0.0) continue;
+    const Vec2 p = ps.position(i);
+    scene.broadphase.query(AABB{p - r, p + r}, [&](ProxyId id) {
+      const Collider& c = scene.colliders[scene.broadphase.user_data(id)];
+      if (c.is_sensor) return;
+
+      SimplexCache cache;
+      const Transform2 xf{ps.position(i), Rot2{}};
+      const PenetrationOutput pen = epa_penetration(c.shape, c.transform, dot, xf, cache);
+      if (pen.separation >= 0.0) return;
+      ++contacts;
+
+      const Vec2 n = pen.normal;
+      ps.x[i] -= n.x * pen.separation;
+      ps.y[i] -= n.y * pen.separation;
+
+      const Vec2 v = ps.velocity(i);
+      const double vn = v.dot(n);
+      if (vn >= 0.0) return;
+      const MaterialPair& mp = materials.pair(ps.material[i], c.material);
+      const Vec2 vt = v - n * vn;
+      const double dvn = -(1.0 + mp.restitution) * vn;
+      const double vt_len = vt.length();
+      const double keep = vt_len > 0.0 ? std::max(0.0, 1.0 - mp.friction * dvn / vt_len) : 0.0;
+      const Vec2 out = n * (-mp.restitution * vn) + vt * keep;
+      ps.vx[i] = out.x;
+      ps.vy[i] = out.y;
+    });
+  }
+  return contacts;
+}
+
+} // namespace sim
+
+#endif // SIM_PARTICLE_COLLISION_HPP
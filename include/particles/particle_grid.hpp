@@ -0,0 +1,149 @@
+#pragma once
+#ifndef SIM_PARTICLE_GRID_HPP
+#define SIM_PARTICLE_GRID_HPP
+// include/particles/particle_grid.hpp
+// Dense cell grid over particle positions, rebuilt by counting sort
+//
+// Design notes:
+//  - build() is two linear passes (count, scatter) with no allocation
+//    once the buffers have grown: cell_start is a prefix sum and
+//    indices holds particle ids sorted by cell
+//  - Cells are row-major, so the cells of one row inside a query box
+//    are adjacent and their particles form one contiguous index span;
+//    region queries hand out one span per row
+//  - The grid covers the particles' bounding box. If that box is huge
+//    compared to the cell size, cells are enlarged to cap the cell count
+//    at a small multiple of the particle count
+//  - Particles with a non-finite coordinate are left out (cell_of() is
+//    kNoCell) and queries with a NaN box return nothing, so one exploded
+//    particle cannot produce out-of-range cell indices
+
+#include "../collision/aabb.hpp"
+#include <algorithm>  // std::min, std::max, std::clamp
+#include <cmath>      // std::floor, std::isfinite, std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Particle Grid
+// -----------------------------
+class ParticleGrid {
+public:
+  static constexpr std::uint32_t kNoCell = 0xFFFFFFFFu;
+
+  explicit ParticleGrid(double cell_size = 1.0) : cell_size_(cell_size) {}
+
+  void build(std::span<const double> x, std::span<const double> y) {
+    const std::size_t n = x.size();
+    double lo_x = std::numeric_limits<double>::infinity(), lo_y = lo_x;
+    double hi_x = -lo_x, hi_y = -lo_x;
+    std::size_t binned = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!std::isfinite(x[i]) || !std::isfinite(y[i])) continue;
+      lo_x = std::min(lo_x, x[i]);
+      lo_y = std::min(lo_y, y[i]);
+      hi_x = std::max(hi_x, x[i]);
+      hi_y = std::max(hi_y, y[i]);
+      ++binned;
+    }
+    count_ = binned;
+    if (binned == 0) {
+      nx_ = ny_ = 0;
+      cell_start_.assign(1, 0);
+      cell_of_.assign(n, kNoCell);
+      indices_.clear();
+      return;
+    }
+
+    // Cap the cell count at ~4 cells per particle
+    const double max_cells = 4.0 * static_cast<double>(binned) + 64.0;
+    double h = cell_size_;
+    const double area = (hi_x - lo_x + h) * (hi_y - lo_y + h);
+    if (area / (h * h) > max_cells) h = std::sqrt(area / max_cells);
+
+    effective_cell_ = h;
+    inv_cell_ = 1.0 / h;
+    origin_ = Vec2{lo_x, lo_y};
+    nx_ = static_cast<int>((hi_x - lo_x) * inv_cell_) + 1;
+    ny_ = static_cast<int>((hi_y - lo_y) * inv_cell_) + 1;
+
+    const std::size_t cells = static_cast<std::size_t>(nx_) * static_cast<std::size_t>(ny_);
+    cell_start_.assign(cells + 1, 0);
+    cell_of_.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!std::isfinite(x[i]) || !std::isfinite(y[i])) {
+        cell_of_[i] = kNoCell;
+        continue;
+      }
+      const int cx = std::min(static_cast<int>((x[i] - lo_x) * inv_cell_), nx_ - 1);
+      const int cy = std::min(static_cast<int>((y[i] - lo_y) * inv_cell_), ny_ - 1);
+      const std::uint32_t c = static_cast<std::uint32_t>(cy * nx_ + cx);
+      cell_of_[i] = c;
+      ++cell_start_[c + 1];
+    }
+    for (std::size_t c = 0; c < cells; ++c) cell_start_[c + 1] += cell_start_[c];
+
+    indices_.resize(binned);
+    cursor_.assign(cell_start_.begin(), cell_start_.end() - 1);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (cell_of_[i] == kNoCell) continue;
+      indices_[cursor_[cell_of_[i]]++] = static_cast<std::uint32_t>(i);
+    }
+  }
+
+  /// Call fn(std::span<const std::uint32_t>) with the particles of the
+  /// cells overlapping box, one contiguous span per grid row. Particles
+  /// near the box edge may lie slightly outside it.
+  template<typename Fn>
+  void for_each_span(const AABB& box, Fn&& fn) const {
+    if (count_ == 0) return;
+    // Written so that a NaN bound fails the test and returns
+    if (!(box.upper.x >= origin_.x && box.upper.y >= origin_.y)) return;
+    if (!(box.lower.x <= origin_.x + nx_ * effective_cell_)) return;
+    if (!(box.lower.y <= origin_.y + ny_ * effective_cell_)) return;
+    const int x0 = clamp_x(box.lower.x), x1 = clamp_x(box.upper.x);
+    const int y0 = clamp_y(box.lower.y), y1 = clamp_y(box.upper.y);
+    for (int cy = y0; cy <= y1; ++cy) {
+      const std::uint32_t begin = cell_start_[static_cast<std::size_t>(cy * nx_ + x0)];
+      const std::uint32_t end = cell_start_[static_cast<std::size_t>(cy * nx_ + x1) + 1];
+      if (begin != end) fn(std::span<const std::uint32_t>(indices_.data() + begin, end - begin));
+    }
+  }
+
+  /// Ids of all binned (finite) particles, sorted by cell
+  [[nodiscard]] std::span<const std::uint32_t> indices() const noexcept { return indices_; }
+  [[nodiscard]] std::uint32_t cell_of(std::size_t particle) const noexcept { return cell_of_[particle]; }
+  [[nodiscard]] int columns() const noexcept { return nx_; }
+  [[nodiscard]] int rows() const noexcept { return ny_; }
+  [[nodiscard]] double cell_size() const noexcept { return effective_cell_; }
+
+private:
+  [[nodiscard]] int clamp_x(double v) const noexcept {
+    return static_cast<int>(std::clamp(std::floor((v - origin_.x) * inv_cell_), 0.0, nx_ - 1.0));
+  }
+  [[nodiscard]] int clamp_y(double v) const noexcept {
+    return static_cast<int>(std::clamp(std::floor((v - origin_.y) * inv_cell_), 0.0, ny_ - 1.0));
+  }
+
+  double cell_size_;
+  double effective_cell_{1.0};
+  double inv_cell_{1.0};
+  Vec2 origin_{};
+  int nx_{0};
+  int ny_{0};
+  std::size_t count_{0};
+
+  std::vector<std::uint32_t> cell_start_;
+  std::vector<std::uint32_t> cursor_;
+  std::vector<std::uint32_t> cell_of_;
+  std::vector<std::uint32_t> indices_;
+};
+
+} // namespace sim
+
+#endif // SIM_PARTICLE_GRID_HPP
@@ -0,0 +1,98 @@
+#pragma once
+#ifndef SIM_PARTICLE_STORE_HPP
+#define SIM_PARTICLE_STORE_HPP
+// include/particles/particle_store.hpp
+// Structure-of-arrays particle storage and integration
+//
+// Design notes:
+//  - One contiguous column per quantity so batch passes (forces,
+//    integration, collision) stream only the columns they touch
+//  - Removal swaps the last particle into the hole: indices are not
+//    stable across remove(), which is the usual price of dense storage
+//  - inv_mass == 0 pins a particle in place
+
+#include "../dynamics/material.hpp"
+#include "../math/vec2.hpp"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Particle Store
+// -----------------------------
+class ParticleStore {
+public:
+  std::vector<double> x, y;
+  std::vector<double> vx, vy;
+  std::vector<double> fx, fy;        ///< accumulated for the current step
+  std::vector<double> inv_mass;
+  std::vector<MaterialId> material;
+
+  /// Every column, in a fixed order, for bulk operations
+  auto columns() { return std::tie(x, y, vx, vy, fx, fy, inv_mass, material); }
+  auto columns() const { return std::tie(x, y, vx, vy, fx, fy, inv_mass, material); }
+
+  std::size_t add(const Vec2& p, const Vec2& v = {}, double mass = 1.0,
+                  MaterialId mat = kDefaultMaterial) {
+    const std::size_t i = x.size();
+    x.push_back(p.x);
+    y.push_back(p.y);
+    vx.push_back(v.x);
+    vy.push_back(v.y);
+    fx.push_back(0.0);
+    fy.push_back(0.0);
+    inv_mass.push_back(mass > 0.0 ? 1.0 / mass : 0.0);
+    material.push_back(mat);
+    return i;
+  }
+
+  void remove(std::size_t i) {
+    std::apply([i](auto&... col) { ((col[i] = col.back(), col.pop_back()), ...); }, columns());
+  }
+
+  void reserve(std::size_t n) {
+    std::apply([n](auto&... col) { (col.reserve(n), ...); }, columns());
+  }
+
+  void clear() noexcept {
+    std::apply([](auto&... col) { (col.clear(), ...); }, columns());
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return x.size(); }
+  [[nodiscard]] bool empty() const noexcept { return x.empty(); }
+
+  [[nodiscard]] Vec2 position(std::size_t i) const noexcept { return Vec2{x[i], y[i]}; }
+  [[nodiscard]] Vec2 velocity(std::size_t i) const noexcept { return Vec2{vx[i], vy[i]}; }
+};
+
+// ─────────────────────────────────────────────────────────────
+// Integration
+// ─────────────────────────────────────────────────────────────
+
+/// Semi-implicit Euler over all particles; clears accumulated forces
+inline void integrate_particles(ParticleStore& ps, const Vec2& gravity, double dt) noexcept {
+  const std::size_t n = ps.size();
+  double* x = ps.x.data();
+  double* y = ps.y.data();
+  double* vx = ps.vx.data();
+  double* vy = ps.vy.data();
+  double* fx = ps.fx.data();
+  double* fy = ps.fy.data();
+  const double* w = ps.inv_mass.data();
+  for (std::size_t i = 0; i < n; ++i) {
+    // Pinned particles (w == 0) get no gravity either
+    const double g = w[i] > 0.0 ? 1.0 : 0.0;
+    vx[i] += (g * gravity.x + fx[i] * w[i]) * dt;
+    vy[i] += (g * gravity.y + fy[i] * w[i]) * dt;
+    x[i] += vx[i] * dt;
+    y[i] += vy[i] * dt;
+    fx[i] = 0.0;
+    fy[i] = 0.0;
+  }
+}
+
+} // namespace sim
+
+#endif // SIM_PARTICLE_STORE_HPP
@@ -0,0 +1,277 @@
+#pragma once
+#ifndef SIM_SELECTIVE_SUBSTEP_HPP
+#define SIM_SELECTIVE_SUBSTEP_HPP
+// include/particles/selective_substep.hpp
+// Soft-sphere particle stepping that sub-steps only the violent particles
+//
+// Design notes:
+//  - Every particle is classified once per step: "hot" when its speed or
+//    acceleration exceeds a threshold. Everything else takes one step
+//  - Hot particles plus a halo of neighbours they can reach this step
+//    form a small sub-simulation that runs `substeps` times. Halo
+//    particles are not re-integrated: they follow their single-step
+//    trajectory (interpolated) and receive the hot particles' contact
+//    impulses at the end, so momentum is exchanged both ways
+//  - Cost scales with the hot set, not the world: an explosion in a
+//    corner no longer forces global substeps
+//  - Contacts are linear springs with dashpot damping between spheres
+//    of `radius`; neighbour search reuses ParticleGrid
+
+#include "particle_grid.hpp"
+#include "particle_store.hpp"
+#include <algorithm>  // std::max, std::min
+#include <cmath>      // std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+struct SubstepConfig {
+  double radius{0.05};            ///< particle radius
+  double stiffness{2.0e4};        ///< contact spring constant
+  double damping{0.0};            ///< contact dashpot along the normal
+  double speed_threshold{5.0};    ///< |v| above this marks a particle hot
+  double accel_threshold{2.0e3};  ///< |a| above this marks a particle hot
+  int substeps{8};                ///< sub-steps taken by the hot set
+};
+
+struct SubstepStats {
+  std::size_t hot{0};
+  std::size_t halo{0};
+  std::size_t pair_tests{0};          ///< single-step neighbour tests
+  std::size_t substep_pair_tests{0};  ///< neighbour tests inside the sub-simulation
+  std::size_t substep_updates{0};     ///< particle updates inside the sub-simulation
+};
+
+// -----------------------------
+// Selective Substepper
+// -----------------------------
+class SelectiveSubstepper {
+public:
+  explicit SelectiveSubstepper(const SubstepConfig& config = {})
+    : config_(config), grid_(4.0 * config.radius), local_grid_(4.0 * config.radius) {}
+
+  [[nodiscard]] const SubstepConfig& config() const noexcept { return config_; }
+  [[nodiscard]] const SubstepStats& stats() const noexcept { return stats_; }
+  /// Particles sub-stepped during the last step()
+  [[nodiscard]] std::span<const std::uint32_t> hot() const noexcept { return hot_; }
+
+  /// Advance by dt. External forces already accumulated in fx/fy are held
+  /// constant over the step and cleared afterwards.
+  void step(ParticleStore& ps, const Vec2& gravity, double dt) {
+    stats_ = SubstepStats{};
+    const std::size_t n = ps.size();
+    hot_.clear();
+    if (n == 0) return;
+
+    // Contact forces for everyone at the start of the step
+    grid_.build(ps.x, ps.y);
+    cfx_.assign(n, 0.0);
+    cfy_.assign(n, 0.0);
+    stats_.pair_tests += contact_forces(ps.x.data(), ps.y.data(), ps.vx.data(), ps.vy.data(), n,
+                                        grid_, [](std::uint32_t, std::uint32_t) { return true; },
+                                        cfx_.data(), cfy_.data());
+
+    // Classify
+    role_.assign(n, Role::cold);
+    const double v2 = config_.speed_threshold * config_.speed_threshold;
+    const double a2 = config_.accel_threshold * config_.accel_threshold;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double w = ps.inv_mass[i];
+      if (w == 0.0) continue;
+      const double ax = gravity.x + (ps.fx[i] + cfx_[i]) * w;
+      const double ay = gravity.y + (ps.fy[i] + cfy_[i]) * w;
+      const double sv = ps.vx[i] * ps.vx[i] + ps.vy[i] * ps.vy[i];
+      if (sv > v2 || ax * ax + ay * ay > a2) {
+        role_[i] = Role::hot;
+        hot_.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+    stats_.hot = hot_.size();
+
+    // Halo: anything a hot particle can reach this step
+    halo_.clear();
+    const double contact = 2.0 * config_.radius;
+    for (const std::uint32_t h : hot_) {
+      const double reach = contact + std::sqrt(ps.vx[h] * ps.vx[h] + ps.vy[h] * ps.vy[h]) * dt;
+      const AABB box{Vec2{ps.x[h] - reach, ps.y[h] - reach}, Vec2{ps.x[h] + reach, ps.y[h] + reach}};
+      grid_.for_each_span(box, [&](std::span<const std::uint32_t> ids) {
+        for (const std::uint32_t j : ids) {
+          if (role_[j] != Role::cold) continue;
+          role_[j] = Role::halo;
+          halo_.push_back(j);
+        }
+      });
+    }
+    stats_.halo = halo_.size();
+
+    // Halo particles get their hot contacts from the sub-simulation instead
+    for (const std::uint32_t j : halo_) {
+      const AABB box{Vec2{ps.x[j] - contact, ps.y[j] - contact}, Vec2{ps.x[j] + contact, ps.y[j] + contact}};
+      grid_.for_each_span(box, [&](std::span<const std::uint32_t> ids) {
+        for (const std::uint32_t h : ids) {
+          if (role_[h] != Role::hot) continue;
+          const Vec2 f = pair_force(ps.x[h], ps.y[h], ps.vx[h], ps.vy[h],
+                                    ps.x[j], ps.y[j], ps.vx[j], ps.vy[j]);
+          cfx_[j] -= f.x;
+          cfy_[j] -= f.y;
+        }
+      });
+    }
+
+    // Single step for everything that is not hot
+    halo_x0_.resize(halo_.size());
+    halo_y0_.resize(halo_.size());
+    for (std::size_t k = 0; k < halo_.size(); ++k) {
+      halo_x0_[k] = ps.x[halo_[k]];
+      halo_y0_[k] = ps.y[halo_[k]];
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (role_[i] == Role::hot) continue;
+      const double w = ps.inv_mass[i];
+      const double g = w > 0.0 ? 1.0 : 0.0;
+      ps.vx[i] += (g * gravity.x + (ps.fx[i] + cfx_[i]) * w) * dt;
+      ps.vy[i] += (g * gravity.y + (ps.fy[i] + cfy_[i]) * w) * dt;
+      ps.x[i] += ps.vx[i] * dt;
+      ps.y[i] += ps.vy[i] * dt;
+    }
+
+    if (!hot_.empty()) substep(ps, gravity, dt);
+
+    std::fill(ps.fx.begin(), ps.fx.end(), 0.0);
+    std::fill(ps.fy.begin(), ps.fy.end(), 0.0);
+  }
+
+private:
+  enum class Role : std::uint8_t { cold, halo, hot };
+
+  /// Force on b from a
+  [[nodiscard]] Vec2 pair_force(double ax, double ay, double avx, double avy,
+                                double bx, double by, double bvx, double bvy) const noexcept {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double d2 = dx * dx + dy * dy;
+    const double contact = 2.0 * config_.radius;
+    if (d2 >= contact * contact || d2 == 0.0) return Vec2{};
+    const double d = std::sqrt(d2);
+    const double nx = dx / d;
+    const double ny = dy / d;
+    const double vn = (bvx - avx) * nx + (bvy - avy) * ny;
+    const double f = std::max(0.0, config_.stiffness * (contact - d) - config_.damping * vn);
+    return Vec2{nx * f, ny * f};
+  }
+
+  /// Accumulate pair forces for all i < j with accept(i, j); returns the
+  /// number of candidate pairs examined
+  template<typename Accept>
+  std::size_t contact_forces(const double* x, const double* y, const double* vx, const double* vy,
+                             std::size_t n, const ParticleGrid& grid, Accept&& accept,
+                             double* fx, double* fy) const {
+    std::size_t tests = 0;
+    const double contact = 2.0 * config_.radius;
+    for (std::size_t i = 0; i < n; ++i) {
+      const AABB box{Vec2{x[i] - contact, y[i] - contact}, Vec2{x[i] + contact, y[i] + contact}};
+      grid.for_each_span(box, [&](std::span<const std::uint32_t> ids) {
+        for (const std::uint32_t j : ids) {
+          if (j <= i) continue;
+          ++tests;
+          if (!accept(static_cast<std::uint32_t>(i), j)) continue;
+          const Vec2 f = pair_force(x[i], y[i], vx[i], vy[i], x[j], y[j], vx[j], vy[j]);
+          fx[j] += f.x;
+          fy[j] += f.y;
+          fx[i] -= f.x;
+          fy[i] -= f.y;
+        }
+      });
+    }
+    return tests;
+  }
+
+  void substep(ParticleStore& ps, const Vec2& gravity, double dt) {
+    const int steps = std::max(config_.substeps, 1);
+    const double h = dt / steps;
+    const std::size_t nh = hot_.size();
+    const std::size_t m = nh + halo_.size();
+
+    // Local SoA: hot first, then halo
+    lx_.resize(m);
+    ly_.resize(m);
+    lvx_.resize(m);
+    lvy_.resize(m);
+    for (std::size_t k = 0; k < nh; ++k) {
+      const std::uint32_t i = hot_[k];
+      lvx_[k] = ps.vx[i];
+      lvy_[k] = ps.vy[i];
+      lx_[k] = ps.x[i];
+      ly_[k] = ps.y[i];
+    }
+    for (std::size_t k = 0; k < halo_.size(); ++k) {
+      lvx_[nh + k] = ps.vx[halo_[k]];
+      lvy_[nh + k] = ps.vy[halo_[k]];
+    }
+    impulse_x_.assign(halo_.size(), 0.0);
+    impulse_y_.assign(halo_.size(), 0.0);
+    auto involves_hot = [nh](std::uint32_t a, std::uint32_t b) { return a < nh || b < nh; };
+
+    for (int s = 0; s < steps; ++s) {
+      // Halo follows its single-step path
+      const double t = (s + 0.5) / steps;
+      for (std::size_t k = 0; k < halo_.size(); ++k) {
+        const std::uint32_t j = halo_[k];
+        lx_[nh + k] = halo_x0_[k] + (ps.x[j] - halo_x0_[k]) * t;
+        ly_[nh + k] = halo_y0_[k] + (ps.y[j] - halo_y0_[k]) * t;
+      }
+
+      stats_.substep_updates += m;
+      local_grid_.build(std::span<const double>(lx_.data(), m), std::span<const double>(ly_.data(), m));
+      lfx_.assign(m, 0.0);
+      lfy_.assign(m, 0.0);
+      stats_.substep_pair_tests += contact_forces(lx_.data(), ly_.data(), lvx_.data(), lvy_.data(),
+                                                  m, local_grid_, involves_hot, lfx_.data(), lfy_.data());
+
+      for (std::size_t k = 0; k < nh; ++k) {
+        const std::uint32_t i = hot_[k];
+        const double w = ps.inv_mass[i];
+        lvx_[k] += (gravity.x + (ps.fx[i] + lfx_[k]) * w) * h;
+        lvy_[k] += (gravity.y + (ps.fy[i] + lfy_[k]) * w) * h;
+        lx_[k] += lvx_[k] * h;
+        ly_[k] += lvy_[k] * h;
+      }
+      for (std::size_t k = 0; k < halo_.size(); ++k) {
+        impulse_x_[k] += lfx_[nh + k] * h;
+        impulse_y_[k] += lfy_[nh + k] * h;
+      }
+    }
+
+    for (std::size_t k = 0; k < nh; ++k) {
+      const std::uint32_t i = hot_[k];
+      ps.x[i] = lx_[k];
+      ps.y[i] = ly_[k];
+      ps.vx[i] = lvx_[k];
+      ps.vy[i] = lvy_[k];
+    }
+    for (std::size_t k = 0; k < halo_.size(); ++k) {
+      const std::uint32_t j = halo_[k];
+      ps.vx[j] += impulse_x_[k] * ps.inv_mass[j];
+      ps.vy[j] += impulse_y_[k] * ps.inv_mass[j];
+    }
+  }
+
+  SubstepConfig config_;
+  ParticleGrid grid_;
+  ParticleGrid local_grid_;
+  SubstepStats stats_{};
+
+  std::vector<double> cfx_, cfy_;
+  std::vector<Role> role_;
+  std::vector<std::uint32_t> hot_, halo_;
+  std::vector<double> halo_x0_, halo_y0_;
+  std::vector<double> lx_, ly_, lvx_, lvy_, lfx_, lfy_;
+  std::vector<double> impulse_x_, impulse_y_;
+};
+
+} // namespace sim
+
+#endif // SIM_SELECTIVE_SUBSTEP_HPP
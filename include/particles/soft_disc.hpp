@@ -0,0 +1,69 @@
+#pragma once
+#ifndef SIM_SOFT_DISC_HPP
+#define SIM_SOFT_DISC_HPP
+// include/particles/soft_disc.hpp
+// Soft-disc particles in a box: the parameters, random initial layout,
+// pair force law and wall response shared by ParticleWorld and
+// LaneWorldBatch
+//
+// Design notes:
+//  - Both world types must agree on physics and on the layout a seed
+//    produces, so they take everything from here rather than keeping
+//    their own copies
+//  - The force and wall helpers are branch-free inline functions: the
+//    lane batch calls them inside loops that must still vectorise
+
+#include "../collision/aabb.hpp"
+#include "../core/xorshift.hpp"
+#include <algorithm>  // std::max, std::min
+#include <cstddef>
+#include <cstdint>
+
+namespace sim {
+
+struct SoftDiscParams {
+  std::size_t particles{1000};
+  AABB box{Vec2{0.0, 0.0}, Vec2{1.0, 1.0}};   ///< walls; particles start in the upper half
+  double radius{0.01};
+  double stiffness{1.0e4};      ///< pair repulsion per unit overlap (unit mass)
+  double damping{20.0};         ///< along the contact normal
+  double restitution{0.5};      ///< against the walls
+  double initial_speed{0.5};    ///< random initial velocity magnitude bound
+  std::uint32_t seed{1};
+};
+
+/// fn(i, position, velocity) for each particle of the layout `seed` gives:
+/// positions uniform in the upper half of the box, velocities uniform in
+/// [-initial_speed, initial_speed]^2
+template<typename Fn>
+void generate_soft_discs(const SoftDiscParams& params, std::uint32_t seed, Fn&& fn) {
+  XorShift32 rng(seed);
+  const AABB& b = params.box;
+  const double mid = 0.5 * (b.lower.y + b.upper.y);
+  const double s = params.initial_speed;
+  for (std::size_t i = 0; i < params.particles; ++i) {
+    const Vec2 p{rng.uniform(b.lower.x, b.upper.x), rng.uniform(mid, b.upper.y)};
+    const Vec2 v{s * (2.0 * rng.next() - 1.0), s * (2.0 * rng.next() - 1.0)};
+    fn(i, p, v);
+  }
+}
+
+/// Repulsion magnitude along the normal for a pair at distance dist
+/// (< 2 radius) closing at normal speed -vn; never attractive
+[[nodiscard]] inline double soft_disc_force(const SoftDiscParams& params, double dist,
+                                            double vn) noexcept {
+  return std::max(0.0, params.stiffness * (2.0 * params.radius - dist) - params.damping * vn);
+}
+
+/// One axis of the wall response: clamp x into [lo, hi] and reflect v,
+/// scaled by restitution e, if it points out of the box
+inline void confine_soft_disc_axis(double& x, double& v, double lo, double hi, double e) noexcept {
+  // Bitwise & and | keep the conditions branch-free
+  const bool bounce = ((x < lo) & (v < 0.0)) | ((x > hi) & (v > 0.0));
+  x = std::min(std::max(x, lo), hi);
+  v = bounce ? -v * e : v;
+}
+
+} // namespace sim
+
+#endif // SIM_SOFT_DISC_HPP
@@ -0,0 +1,182 @@
+#pragma once
+#ifndef SIM_VECTOR_ENV_HPP
+#define SIM_VECTOR_ENV_HPP
+// include/particles/vector_env.hpp
+// Vectorised reinforcement-learning environment over an ensemble of
+// lane-batched particle worlds: reset() and step(actions) for all
+// environments at once, writing into caller-provided buffers
+//
+// Design notes:
+//  - Task: each environment is a small particle cloud in a box. The action
+//    is a 2D acceleration (in [-1, 1]^2, scaled by max_accel) applied on
+//    top of gravity; the goal is to bring the cloud's centre to a random
+//    target. Reward is minus the distance; reaching the target ends the
+//    episode, so does running out of steps
+//  - Environment e lives in lane e % Lanes of batch e / Lanes. One job per
+//    batch applies the actions, steps frame_skip times and writes the
+//    results, so threads touch disjoint slices of every buffer
+//  - step() does not allocate: buffers are the caller's, per-environment
+//    state is sized at construction, and the job closure fits in
+//    std::function's inline storage
+//  - Finished environments are reset inside step(). As in common vector
+//    env APIs, done[e] = 1 marks that the returned observation already
+//    belongs to the next episode; reward[e] is the last step's reward
+
+#include "ensemble.hpp"
+#include "lane_batch.hpp"
+#include <algorithm>  // std::clamp, std::min
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+struct VectorEnvConfig {
+  std::size_t envs{64};
+  LaneWorldParams world{};
+  double dt{1.0 / 240.0};
+  int frame_skip{4};             ///< world steps per env step
+  int horizon{200};              ///< env steps before an episode is cut off
+  double max_accel{20.0};        ///< action scale
+  double success_radius{0.05};   ///< centre-to-target distance that ends an episode
+  Vec2 gravity{0.0, -9.81};
+};
+
+// -----------------------------
+// Vector Env
+// -----------------------------
+template<std::size_t Lanes = kDefaultLanes>
+class VectorEnv {
+public:
+  static constexpr std::size_t kActionDim = 2;
+
+  explicit VectorEnv(const VectorEnvConfig& config, TaskPool* pool = nullptr)
+      : config_(config), ensemble_(pool),
+        targets_(config.envs), episodes_(config.envs, 0), elapsed_(config.envs, 0) {
+    const std::size_t batches = (config.envs + Lanes - 1) / Lanes;
+    for (std::size_t b = 0; b < batches; ++b) ensemble_.emplace(config.world);
+  }
+
+  [[nodiscard]] std::size_t num_envs() const noexcept { return config_.envs; }
+  /// Centre offset to target (2), mean velocity (2), particle offsets from the centre (2 each)
+  [[nodiscard]] std::size_t obs_dim() const noexcept { return 4 + 2 * config_.world.particles; }
+  [[nodiscard]] static constexpr std::size_t action_dim() noexcept { return kActionDim; }
+  [[nodiscard]] const VectorEnvConfig& config() const noexcept { return config_; }
+
+  /// Start a new episode in every environment; obs is num_envs x obs_dim
+  void reset(std::span<double> obs, std::uint32_t seed = 1) {
+    assert(obs.size() >= num_envs() * obs_dim() && "obs buffer too small");
+    seed_ = seed;
+    for (std::size_t e = 0; e < config_.envs; ++e) {
+      episodes_[e] = 0;
+      begin_episode(e);
+      write_obs(e, obs.subspan(e * obs_dim(), obs_dim()));
+    }
+  }
+
+  /// Apply actions (num_envs x 2), advance every environment one env step
+  /// and write obs (num_envs x obs_dim), reward and done (num_envs each)
+  void step(std::span<const double> actions, std::span<double> obs, std::span<double> reward,
+            std::span<std::uint8_t> done) {
+    // Jobs write into these from worker threads, so check the sizes up front
+    assert(actions.size() >= num_envs() * kActionDim && "actions buffer too small");
+    assert(obs.size() >= num_envs() * obs_dim() && "obs buffer too small");
+    assert(reward.size() >= num_envs() && "reward buffer too small");
+    assert(done.size() >= num_envs() && "done buffer too small");
+    const StepArgs args{actions, obs, reward, done};
+    ensemble_.for_each([this, &args](LaneWorldBatch<Lanes>& world, std::size_t b) {
+      step_batch(world, b, args);
+    });
+  }
+
+  /// Current target of environment e
+  [[nodiscard]] Vec2 target(std::size_t e) const noexcept { return targets_[e]; }
+  /// Episodes finished so far by environment e
+  [[nodiscard]] std::uint64_t episodes(std::size_t e) const noexcept { return episodes_[e]; }
+  [[nodiscard]] const LaneWorldBatch<Lanes>& batch(std::size_t b) const noexcept { return ensemble_.world(b); }
+
+private:
+  struct StepArgs {
+    std::span<const double> actions;
+    std::span<double> obs;
+    std::span<double> reward;
+    std::span<std::uint8_t> done;
+  };
+
+  void step_batch(LaneWorldBatch<Lanes>& world, std::size_t b, const StepArgs& args) {
+    const std::size_t first = b * Lanes;
+    const std::size_t count = std::min(Lanes, config_.envs - first);
+    for (std::size_t l = 0; l < count; ++l) {
+      const double ax = std::clamp(args.actions[(first + l) * kActionDim], -1.0, 1.0);
+      const double ay = std::clamp(args.actions[(first + l) * kActionDim + 1], -1.0, 1.0);
+      world.set_acceleration(l, config_.gravity + Vec2{ax, ay} * config_.max_accel);
+    }
+    for (int s = 0; s < config_.frame_skip; ++s) world.step(config_.dt);
+
+    for (std::size_t l = 0; l < count; ++l) {
+      const std::size_t e = first + l;
+      const double dist = (world.center(l) - targets_[e]).length();
+      ++elapsed_[e];
+      const bool reached = dist < config_.success_radius;
+      const bool finished = reached || elapsed_[e] >= config_.horizon;
+      args.reward[e] = -dist;
+      args.done[e] = finished ? 1 : 0;
+      if (finished) {
+        ++episodes_[e];
+        begin_episode(e);
+      }
+      write_obs(e, args.obs.subspan(e * obs_dim(), obs_dim()));
+    }
+  }
+
+  /// Re-seed environment e's lane and draw a new target
+  void begin_episode(std::size_t e) {
+    // Distinct, reproducible seed per (run seed, env, episode)
+    std::uint32_t h = seed_ * 0x9E3779B9u ^ static_cast<std::uint32_t>(e) * 0x85EBCA6Bu ^
+                      static_cast<std::uint32_t>(episodes_[e]) * 0xC2B2AE35u;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    ensemble_.world(e / Lanes).reset_lane(e % Lanes, h != 0 ? h : 1u);
+
+    const AABB& box = config_.world.box;
+    const Vec2 margin = box.extents() * 0.5;
+    const double u = static_cast<double>(h & 0xFFFF) / 65535.0;
+    const double v = static_cast<double>(h >> 16) / 65535.0;
+    targets_[e] = Vec2{box.lower.x + margin.x + u * (box.upper.x - box.lower.x - 2.0 * margin.x),
+                       box.lower.y + margin.y + v * (box.upper.y - box.lower.y - 2.0 * margin.y)};
+    elapsed_[e] = 0;
+  }
+
+  void write_obs(std::size_t e, std::span<double> out) const noexcept {
+    const LaneWorldBatch<Lanes>& world = ensemble_.world(e / Lanes);
+    const std::size_t lane = e % Lanes;
+    const std::size_t n = world.particle_count();
+    const Vec2 c = world.center(lane);
+    Vec2 v{};
+    for (std::size_t i = 0; i < n; ++i) v += world.velocity(i, lane);
+    if (n > 0) v = v / static_cast<double>(n);
+    out[0] = c.x - targets_[e].x;
+    out[1] = c.y - targets_[e].y;
+    out[2] = v.x;
+    out[3] = v.y;
+    for (std::size_t i = 0; i < n; ++i) {
+      const Vec2 p = world.position(i, lane) - c;
+      out[4 + 2 * i] = p.x;
+      out[5 + 2 * i] = p.y;
+    }
+  }
+
+  VectorEnvConfig config_;
+  Ensemble<LaneWorldBatch<Lanes>> ensemble_;
+  std::vector<Vec2> targets_;
+  std::vector<std::uint64_t> episodes_;
+  std::vector<int> elapsed_;
+  std::uint32_t seed_{1};
+};
+
+} // namespace sim
+
+#endif // SIM_VECTOR_ENV_HPP
@@ -0,0 +1,287 @@
+#pragma once
+#ifndef SIM_FLUID_SURFACE_HPP
+#define SIM_FLUID_SURFACE_HPP
+// include/render/fluid_surface.hpp
+// Fluid surface for rendering: particles splatted into a density grid,
+// iso-contour extracted with marching squares, rebuilt per tile
+//
+// Design notes:
+//  - The grid is split into square tiles. Each tile owns its nodes and
+//    its contour segments, so tiles rebuild independently and in
+//    parallel with no shared writes (border nodes are duplicated)
+//  - Particles are splatted at a snapshot of their position. A particle
+//    only refreshes its snapshot once it has moved more than
+//    move_tolerance, and then dirties the tiles around its old and new
+//    snapshot. Settled regions of the fluid cost nothing per frame
+//  - Because clean and dirty tiles both read snapshots, the field stays
+//    continuous across tile borders; the surface lags the particles by
+//    at most move_tolerance
+//  - A change in particle count re-snapshots everything (swap-removal in
+//    the store reorders particles)
+//  - Saddle cells are resolved with the cell-centre average, so the
+//    contour never crosses itself
+
+#include "../collision/aabb.hpp"
+#include "../core/parallel_for.hpp"
+#include "../particles/particle_store.hpp"
+#include <algorithm>  // std::clamp, std::max, std::min
+#include <cmath>      // std::ceil, std::floor
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+struct FluidSurfaceConfig {
+  AABB domain{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}};
+  double cell{0.1};              ///< grid spacing
+  double radius{0.25};           ///< splat kernel support
+  double iso{0.5};               ///< density level drawn as the surface
+  int tile_cells{16};            ///< tile width in cells
+  double move_tolerance{0.02};   ///< snapshot refresh distance
+};
+
+struct SurfaceSegment {
+  Vec2 a{};
+  Vec2 b{};
+};
+
+struct FluidSurfaceStats {
+  std::size_t tiles{0};
+  std::size_t tiles_rebuilt{0};
+  std::size_t particles_moved{0};
+  std::size_t segments{0};
+};
+
+// -----------------------------
+// Fluid Surface
+// -----------------------------
+class FluidSurface {
+public:
+  explicit FluidSurface(const FluidSurfaceConfig& config, TaskPool* pool = nullptr)
+    : cfg_(config), pool_(pool) {
+    const Vec2 size = cfg_.domain.upper - cfg_.domain.lower;
+    const int cells_x = std::max(1, static_cast<int>(std::ceil(size.x / cfg_.cell)));
+    const int cells_y = std::max(1, static_cast<int>(std::ceil(size.y / cfg_.cell)));
+    tiles_x_ = (cells_x + cfg_.tile_cells - 1) / cfg_.tile_cells;
+    tiles_y_ = (cells_y + cfg_.tile_cells - 1) / cfg_.tile_cells;
+    tile_world_ = cfg_.tile_cells * cfg_.cell;
+    const std::size_t tiles = static_cast<std::size_t>(tiles_x_) * static_cast<std::size_t>(tiles_y_);
+    const std::size_t nodes = static_cast<std::size_t>(cfg_.tile_cells + 1) * (cfg_.tile_cells + 1);
+    tiles_.resize(tiles);
+    for (Tile& t : tiles_) t.density.assign(nodes, 0.0);
+    dirty_.assign(tiles, 1);
+  }
+
+  /// Bring the surface up to date with ps; returns the tiles rebuilt
+  std::size_t update(const ParticleStore& ps) {
+    stats_ = FluidSurfaceStats{};
+    stats_.tiles = tiles_.size();
+    snapshot(ps);
+    bin();
+
+    rebuild_.clear();
+    for (std::size_t t = 0; t < tiles_.size(); ++t) {
+      if (dirty_[t] != 0) rebuild_.push_back(static_cast<std::uint32_t>(t));
+    }
+    parallel_for(pool_, rebuild_.size(), [this](std::size_t k) { rebuild_tile(rebuild_[k]); });
+    std::fill(dirty_.begin(), dirty_.end(), 0);
+
+    stats_.tiles_rebuilt = rebuild_.size();
+    for (const Tile& t : tiles_) stats_.segments += t.segments.size();
+    return rebuild_.size();
+  }
+
+  /// Call fn(const SurfaceSegment&) for every contour segment
+  template<typename Fn>
+  void for_each_segment(Fn&& fn) const {
+    for (const Tile& t : tiles_) {
+      for (const SurfaceSegment& s : t.segments) fn(s);
+    }
+  }
+
+  /// Density at grid node (i, j), read from the tile that owns it
+  [[nodiscard]] double density(int i, int j) const noexcept {
+    const int tx = std::min(i / cfg_.tile_cells, tiles_x_ - 1);
+    const int ty = std::min(j / cfg_.tile_cells, tiles_y_ - 1);
+    const Tile& t = tiles_[static_cast<std::size_t>(ty * tiles_x_ + tx)];
+    return t.density[node(i - tx * cfg_.tile_cells, j - ty * cfg_.tile_cells)];
+  }
+
+  /// Force a full rebuild on the next update
+  void invalidate() { std::fill(dirty_.begin(), dirty_.end(), 1); }
+
+  [[nodiscard]] const FluidSurfaceStats& stats() const noexcept { return stats_; }
+  [[nodiscard]] std::size_t tile_count() const noexcept { return tiles_.size(); }
+  [[nodiscard]] const FluidSurfaceConfig& config() const noexcept { return cfg_; }
+
+private:
+  struct Tile {
+    std::vector<double> density;
+    std::vector<SurfaceSegment> segments;
+  };
+
+  [[nodiscard]] std::size_t node(int i, int j) const noexcept {
+    return static_cast<std::size_t>(j) * static_cast<std::size_t>(cfg_.tile_cells + 1) +
+           static_cast<std::size_t>(i);
+  }
+
+  [[nodiscard]] int tile_x(double x) const noexcept {
+    return std::clamp(static_cast<int>(std::floor((x - cfg_.domain.lower.x) / tile_world_)), 0, tiles_x_ - 1);
+  }
+  [[nodiscard]] int tile_y(double y) const noexcept {
+    return std::clamp(static_cast<int>(std::floor((y - cfg_.domain.lower.y) / tile_world_)), 0, tiles_y_ - 1);
+  }
+
+  /// Dirty every tile whose splat footprint can contain p
+  void mark(double x, double y) noexcept {
+    const int x0 = tile_x(x - cfg_.radius), x1 = tile_x(x + cfg_.radius);
+    const int y0 = tile_y(y - cfg_.radius), y1 = tile_y(y + cfg_.radius);
+    for (int ty = y0; ty <= y1; ++ty) {
+      for (int tx = x0; tx <= x1; ++tx) dirty_[static_cast<std::size_t>(ty * tiles_x_ + tx)] = 1;
+    }
+  }
+
+  void snapshot(const ParticleStore& ps) {
+    const std::size_t n = ps.size();
+    if (sx_.size() != n) {
+      sx_.assign(ps.x.begin(), ps.x.end());
+      sy_.assign(ps.y.begin(), ps.y.end());
+      invalidate();
+      stats_.particles_moved = n;
+      return;
+    }
+    const double tol2 = cfg_.move_tolerance * cfg_.move_tolerance;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double dx = ps.x[i] - sx_[i];
+      const double dy = ps.y[i] - sy_[i];
+      if (dx * dx + dy * dy <= tol2) continue;
+      mark(sx_[i], sy_[i]);
+      mark(ps.x[i], ps.y[i]);
+      sx_[i] = ps.x[i];
+      sy_[i] = ps.y[i];
+      ++stats_.particles_moved;
+    }
+  }
+
+  /// Counting sort of snapshot positions by tile
+  void bin() {
+    const std::size_t tiles = tiles_.size();
+    bin_start_.assign(tiles + 1, 0);
+    bin_of_.resize(sx_.size());
+    for (std::size_t i = 0; i < sx_.size(); ++i) {
+      const auto t = static_cast<std::uint32_t>(tile_y(sy_[i]) * tiles_x_ + tile_x(sx_[i]));
+      bin_of_[i] = t;
+      ++bin_start_[t + 1];
+    }
+    for (std::size_t t = 0; t < tiles; ++t) bin_start_[t + 1] += bin_start_[t];
+    binned_.resize(sx_.size());
+    cursor_.assign(bin_start_.begin(), bin_start_.end() - 1);
+    for (std::size_t i = 0; i < sx_.size(); ++i) binned_[cursor_[bin_of_[i]]++] = static_cast<std::uint32_t>(i);
+  }
+
+  void rebuild_tile(std::uint32_t index) {
+    Tile& tile = tiles_[index];
+    const int tx = static_cast<int>(index) % tiles_x_;
+    const int ty = static_cast<int>(index) / tiles_x_;
+    const int n = cfg_.tile_cells + 1;
+    const Vec2 origin = cfg_.domain.lower + Vec2{tx * tile_world_, ty * tile_world_};
+    const double h = cfg_.cell;
+    const double r = cfg_.radius;
+    const double inv_r2 = 1.0 / (r * r);
+
+    // Splat: poly6-style kernel (1 - d^2/r^2)^3
+    std::fill(tile.density.begin(), tile.density.end(), 0.0);
+    const int bx0 = tile_x(origin.x - r), bx1 = tile_x(origin.x + tile_world_ + r);
+    const int by0 = tile_y(origin.y - r), by1 = tile_y(origin.y + tile_world_ + r);
+    for (int by = by0; by <= by1; ++by) {
+      const std::size_t b0 = static_cast<std::size_t>(by * tiles_x_ + bx0);
+      const std::size_t b1 = static_cast<std::size_t>(by * tiles_x_ + bx1);
+      for (std::uint32_t k = bin_start_[b0]; k < bin_start_[b1 + 1]; ++k) {
+        const std::uint32_t p = binned_[k];
+        const double px = sx_[p] - origin.x;
+        const double py = sy_[p] - origin.y;
+        const int i0 = std::max(0, static_cast<int>(std::ceil((px - r) / h)));
+        const int i1 = std::min(n - 1, static_cast<int>(std::floor((px + r) / h)));
+        const int j0 = std::max(0, static_cast<int>(std::ceil((py - r) / h)));
+        const int j1 = std::min(n - 1, static_cast<int>(std::floor((py + r) / h)));
+        for (int j = j0; j <= j1; ++j) {
+          const double dy = j * h - py;
+          for (int i = i0; i <= i1; ++i) {
+            const double dx = i * h - px;
+            const double q = std::max(0.0, 1.0 - (dx * dx + dy * dy) * inv_r2);
+            tile.density[node(i, j)] += q * q * q;
+          }
+        }
+      }
+    }
+    contour(tile, origin);
+  }
+
+  /// Marching squares over one tile's cells
+  void contour(Tile& tile, const Vec2& origin) const {
+    tile.segments.clear();
+    const double h = cfg_.cell;
+    const double iso = cfg_.iso;
+    const int n = cfg_.tile_cells;
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        // Corners counter-clockwise from bottom-left
+        const double v[4] = {tile.density[node(i, j)], tile.density[node(i + 1, j)],
+                             tile.density[node(i + 1, j + 1)], tile.density[node(i, j + 1)]};
+        const int mask = (v[0] > iso ? 1 : 0) | (v[1] > iso ? 2 : 0) | (v[2] > iso ? 4 : 0) |
+                         (v[3] > iso ? 8 : 0);
+        if (mask == 0 || mask == 15) continue;
+
+        const Vec2 base = origin + Vec2{i * h, j * h};
+        const Vec2 corner[4] = {base, base + Vec2{h, 0.0}, base + Vec2{h, h}, base + Vec2{0.0, h}};
+        // Crossing point on edge e (corner e -> corner e + 1)
+        auto edge = [&](int e) {
+          const int a = e, b = (e + 1) & 3;
+          const double t = (iso - v[a]) / (v[b] - v[a]);
+          return corner[a].lerp(corner[b], t);
+        };
+        auto emit = [&](int e0, int e1) { tile.segments.push_back(SurfaceSegment{edge(e0), edge(e1)}); };
+
+        switch (mask) {
+          case 1: case 14: emit(3, 0); break;
+          case 2: case 13: emit(0, 1); break;
+          case 3: case 12: emit(3, 1); break;
+          case 4: case 11: emit(1, 2); break;
+          case 6: case 9:  emit(0, 2); break;
+          case 7: case 8:  emit(3, 2); break;
+          case 5: case 10: {
+            // Saddle: decide whether the inside corners connect through the centre
+            const bool centre_in = 0.25 * (v[0] + v[1] + v[2] + v[3]) > iso;
+            if ((mask == 5) == centre_in) {
+              emit(0, 1);
+              emit(2, 3);
+            } else {
+              emit(3, 0);
+              emit(1, 2);
+            }
+            break;
+          }
+          default: break;
+        }
+      }
+    }
+  }
+
+  FluidSurfaceConfig cfg_;
+  TaskPool* pool_;
+  int tiles_x_{0};
+  int tiles_y_{0};
+  double tile_world_{1.0};
+
+  std::vector<Tile> tiles_;
+  std::vector<std::uint8_t> dirty_;
+  std::vector<std::uint32_t> rebuild_;
+  std::vector<double> sx_, sy_;          ///< splatted (snapshot) positions
+  std::vector<std::uint32_t> bin_start_, bin_of_, binned_, cursor_;
+  FluidSurfaceStats stats_{};
+};
+
+} // namespace sim
+
+#endif // SIM_FLUID_SURFACE_HPP
@@ -0,0 +1,133 @@
+#pragma once
+#ifndef SIM_FRAME_WRITER_HPP
+#define SIM_FRAME_WRITER_HPP
+// include/render/frame_writer.hpp
+// Background thread that encodes and writes numbered frames
+//
+// Design notes:
+//  - submit() moves the image into a bounded queue and returns; encoding
+//    and disk I/O run on the worker, overlapped with simulation
+//  - When the queue is full submit() blocks rather than dropping frames:
+//    a validation video with holes is worse than a slower run
+//  - Frames are named <prefix><index, zero-padded to 6><extension> so
+//    tools like ffmpeg can pick them up as an image sequence
+
+#include "image_io.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace sim {
+
+struct FrameWriterStats {
+  std::uint64_t submitted{0};
+  std::uint64_t written{0};
+  std::uint64_t failed{0};
+  std::uint64_t bytes{0};
+  std::uint64_t producer_waits{0};  ///< submits that blocked on a full queue
+};
+
+// -----------------------------
+// Frame Writer
+// -----------------------------
+class FrameWriter {
+public:
+  FrameWriter(std::string prefix, ImageFormat format, std::size_t max_queued = 4)
+    : prefix_(std::move(prefix)), format_(format), max_queued_(max_queued > 0 ? max_queued : 1),
+      worker_([this] { run(); }) {}
+
+  FrameWriter(const FrameWriter&) = delete;
+  FrameWriter& operator=(const FrameWriter&) = delete;
+
+  ~FrameWriter() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    wake_worker_.notify_one();
+    worker_.join();
+  }
+
+  /// Queue a frame for encoding; blocks while the queue is full
+  void submit(Image image) {
+    std::unique_lock lock(mutex_);
+    if (queue_.size() >= max_queued_) {
+      ++stats_.producer_waits;
+      wake_producer_.wait(lock, [this] { return queue_.size() < max_queued_; });
+    }
+    queue_.push_back(Job{next_index_++, std::move(image)});
+    ++stats_.submitted;
+    lock.unlock();
+    wake_worker_.notify_one();
+  }
+
+  /// Block until every submitted frame is on disk
+  void flush() {
+    std::unique_lock lock(mutex_);
+    wake_producer_.wait(lock, [this] { return queue_.empty() && !busy_; });
+  }
+
+  [[nodiscard]] FrameWriterStats stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+  }
+
+  [[nodiscard]] std::string frame_path(std::uint64_t index) const {
+    char digits[32];
+    std::snprintf(digits, sizeof(digits), "%06llu", static_cast<unsigned long long>(index));
+    return prefix_ + digits + extension(format_);
+  }
+
+private:
+  struct Job {
+    std::uint64_t index;
+    Image image;
+  };
+
+  void run() {
+    std::unique_lock lock(mutex_);
+    for (;;) {
+      wake_worker_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;  // stopping, and everything is written
+      Job job = std::move(queue_.front());
+      queue_.pop_front();
+      busy_ = true;
+      lock.unlock();
+      wake_producer_.notify_all();
+
+      const std::vector<std::uint8_t> bytes = encode_image(job.image, format_);
+      const bool ok = write_file(frame_path(job.index), bytes);
+
+      lock.lock();
+      busy_ = false;
+      ++(ok ? stats_.written : stats_.failed);
+      if (ok) stats_.bytes += bytes.size();
+      wake_producer_.notify_all();
+    }
+  }
+
+  std::string prefix_;
+  ImageFormat format_;
+  std::size_t max_queued_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable wake_worker_;
+  std::condition_variable wake_producer_;
+  std::deque<Job> queue_;
+  std::uint64_t next_index_{0};
+  bool busy_{false};
+  bool stopping_{false};
+  FrameWriterStats stats_{};
+
+  std::thread worker_;  // last: starts after every other member exists
+};
+
+} // namespace sim
+
+#endif // SIM_FRAME_WRITER_HPP
@@ -0,0 +1,151 @@
+#pragma once
+#ifndef SIM_IMAGE_IO_HPP
+#define SIM_IMAGE_IO_HPP
+// include/render/image_io.hpp
+// Dependency-free image encoders: PNG (stored deflate) and binary PPM
+//
+// Design notes:
+//  - PNG uses uncompressed deflate blocks, so encoding is a copy plus
+//    CRC/Adler checksums; files are larger than zlib output but any
+//    viewer or ffmpeg reads them, and no third-party code is needed
+//  - Encoders write into a byte vector; file output is a separate step,
+//    which lets the async writer encode off the simulation thread
+//  - Writers return false on I/O failure instead of throwing
+
+#include "raster.hpp"
+#include <algorithm>  // std::min
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+enum class ImageFormat : std::uint8_t { png, ppm };
+
+namespace detail {
+
+inline const std::array<std::uint32_t, 256>& crc_table() noexcept {
+  static const std::array<std::uint32_t, 256> table = [] {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t n = 0; n < 256; ++n) {
+      std::uint32_t c = n;
+      for (int k = 0; k < 8; ++k) c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      t[n] = c;
+    }
+    return t;
+  }();
+  return table;
+}
+
+[[nodiscard]] inline std::uint32_t crc32(const std::uint8_t* data, std::size_t n,
+                                         std::uint32_t crc = 0) noexcept {
+  const auto& t = crc_table();
+  crc = ~crc;
+  for (std::size_t i = 0; i < n; ++i) crc = t[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+  return ~crc;
+}
+
+inline void put_u32_be(std::vector<std::uint8_t>& out, std::uint32_t v) {
+  out.push_back(static_cast<std::uint8_t>(v >> 24));
+  out.push_back(static_cast<std::uint8_t>(v >> 16));
+  out.push_back(static_cast<std::uint8_t>(v >> 8));
+  out.push_back(static_cast<std::uint8_t>(v));
+}
+
+inline void put_chunk(std::vector<std::uint8_t>& out, const char type[4],
+                      const std::vector<std::uint8_t>& data) {
+  put_u32_be(out, static_cast<std::uint32_t>(data.size()));
+  const std::size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  put_u32_be(out, crc32(out.data() + start, out.size() - start));
+}
+
+} // namespace detail
+
+// ─────────────────────────────────────────────────────────────
+// Encoders
+// ─────────────────────────────────────────────────────────────
+
+/// RGBA8 PNG with stored (uncompressed) deflate blocks
+[[nodiscard]] inline std::vector<std::uint8_t> encode_png(const Image& img) {
+  std::vector<std::uint8_t> out{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+  std::vector<std::uint8_t> ihdr;
+  detail::put_u32_be(ihdr, static_cast<std::uint32_t>(img.width));
+  detail::put_u32_be(ihdr, static_cast<std::uint32_t>(img.height));
+  ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0});  // 8-bit RGBA, deflate, no filter, no interlace
+  detail::put_chunk(out, "IHDR", ihdr);
+
+  // Raw scanlines, each prefixed with filter type 0
+  const std::size_t row = static_cast<std::size_t>(img.width) * 4;
+  std::vector<std::uint8_t> raw;
+  raw.reserve((row + 1) * static_cast<std::size_t>(img.height));
+  for (int y = 0; y < img.height; ++y) {
+    raw.push_back(0);
+    const auto* p = img.pixels.data() + row * static_cast<std::size_t>(y);
+    raw.insert(raw.end(), p, p + row);
+  }
+
+  // zlib stream: header, stored blocks of at most 65535 bytes, Adler-32
+  std::vector<std::uint8_t> z{0x78, 0x01};
+  z.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+  std::size_t pos = 0;
+  do {
+    const std::size_t len = std::min<std::size_t>(65535, raw.size() - pos);
+    const bool last = pos + len == raw.size();
+    z.push_back(last ? 1 : 0);
+    z.push_back(static_cast<std::uint8_t>(len));
+    z.push_back(static_cast<std::uint8_t>(len >> 8));
+    z.push_back(static_cast<std::uint8_t>(~len));
+    z.push_back(static_cast<std::uint8_t>(~len >> 8));
+    z.insert(z.end(), raw.begin() + static_cast<std::ptrdiff_t>(pos),
+             raw.begin() + static_cast<std::ptrdiff_t>(pos + len));
+    pos += len;
+  } while (pos < raw.size());
+  std::uint32_t a = 1, b = 0;
+  for (const std::uint8_t v : raw) {
+    a = (a + v) % 65521u;
+    b = (b + a) % 65521u;
+  }
+  detail::put_u32_be(z, (b << 16) | a);
+  detail::put_chunk(out, "IDAT", z);
+  detail::put_chunk(out, "IEND", {});
+  return out;
+}
+
+/// Binary PPM (P6); alpha is dropped
+[[nodiscard]] inline std::vector<std::uint8_t> encode_ppm(const Image& img) {
+  const std::string header =
+    "P6\n" + std::to_string(img.width) + " " + std::to_string(img.height) + "\n255\n";
+  std::vector<std::uint8_t> out(header.begin(), header.end());
+  out.reserve(out.size() + static_cast<std::size_t>(img.width) * img.height * 3);
+  for (std::size_t i = 0; i < img.pixels.size(); i += 4) {
+    out.insert(out.end(), img.pixels.begin() + static_cast<std::ptrdiff_t>(i),
+               img.pixels.begin() + static_cast<std::ptrdiff_t>(i + 3));
+  }
+  return out;
+}
+
+[[nodiscard]] inline std::vector<std::uint8_t> encode_image(const Image& img, ImageFormat format) {
+  return format == ImageFormat::png ? encode_png(img) : encode_ppm(img);
+}
+
+[[nodiscard]] constexpr const char* extension(ImageFormat format) noexcept {
+  return format == ImageFormat::png ? ".png" : ".ppm";
+}
+
+/// Write bytes to path; false on failure
+inline bool write_file(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (f == nullptr) return false;
+  const bool ok = std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+  return std::fclose(f) == 0 && ok;
+}
+
+} // namespace sim
+
+#endif // SIM_IMAGE_IO_HPP
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef SIM_PARTICLE_CULLING_HPP
+#define SIM_PARTICLE_CULLING_HPP
+// include/render/particle_culling.hpp
+// CPU-side view culling and density LOD for particle draws
+//
+// Design notes:
+//  - Culling walks the ParticleGrid rows that overlap the view, so cost
+//    scales with what is on screen, not with the store size
+//  - LOD bins visible particles into screen-space cells a few pixels
+//    wide. A cell holding merge_threshold or more particles is drawn as
+//    one impostor point at the cell's centroid, sized to cover the same
+//    area; sparse cells keep their individual particles. Zooming out
+//    packs more particles per cell, so detail drops where it cannot be
+//    seen anyway
+//  - Output is a float SoA draw list (x, y, size) ready to upload as-is:
+//    half the bytes of the double columns, and only what is visible
+//  - LOD cell accumulators are dense over the view and reset through a
+//    touched-cell list, so a frame costs O(visible), not O(view cells)
+
+#include "../particles/particle_grid.hpp"
+#include "../particles/particle_store.hpp"
+#include <algorithm>  // std::clamp
+#include <cmath>      // std::ceil, std::floor, std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sim {
+
+struct CullParams {
+  AABB view{};                        ///< visible world rectangle
+  double pixels_per_unit{100.0};      ///< current zoom
+  double particle_radius{0.05};       ///< world units
+  double lod_pixels{4.0};             ///< LOD cell width on screen; 0 disables LOD
+  std::uint32_t merge_threshold{4};   ///< particles per cell that become an impostor
+};
+
+/// Float SoA buffers for the renderer. size is a radius in world units.
+struct ParticleDrawList {
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> size;
+
+  void clear() noexcept {
+    x.clear();
+    y.clear();
+    size.clear();
+  }
+  [[nodiscard]] std::size_t count() const noexcept { return x.size(); }
+
+  void push(double px, double py, double r) {
+    x.push_back(static_cast<float>(px));
+    y.push_back(static_cast<float>(py));
+    size.push_back(static_cast<float>(r));
+  }
+};
+
+struct CullStats {
+  std::size_t tested{0};       ///< particles in grid rows overlapping the view
+  std::size_t visible{0};
+  std::size_t individual{0};   ///< drawn as themselves
+  std::size_t impostors{0};
+  std::size_t merged{0};       ///< particles represented by impostors
+};
+
+// -----------------------------
+// Particle Culler
+// -----------------------------
+class ParticleCuller {
+public:
+  /// Cull against a grid already built over ps this frame
+  const ParticleDrawList& cull(const ParticleStore& ps, const ParticleGrid& grid,
+                               const CullParams& params) {
+    draw_.clear();
+    stats_ = CullStats{};
+    visible_.clear();
+
+    const double r = params.particle_radius;
+    const AABB view = params.view.extended(r);
+    grid.for_each_span(view, [&](std::span<const std::uint32_t> ids) {
+      stats_.tested += ids.size();
+      for (const std::uint32_t i : ids) {
+        if (view.contains(Vec2{ps.x[i], ps.y[i]})) visible_.push_back(i);
+      }
+    });
+    stats_.visible = visible_.size();
+
+    const double lod_cell = params.lod_pixels / params.pixels_per_unit;
+    // Without LOD, or when a cell is smaller than a particle, draw everything
+    if (params.lod_pixels <= 0.0 || lod_cell <= 2.0 * r || params.merge_threshold < 2) {
+      for (const std::uint32_t i : visible_) draw_.push(ps.x[i], ps.y[i], r);
+      stats_.individual = visible_.size();
+      return draw_;
+    }
+
+    bin(ps, view, lod_cell);
+    for (std::size_t k = 0; k < visible_.size(); ++k) {
+      if (cells_[cell_ids_[k]].count >= params.merge_threshold) continue;
+      const std::uint32_t i = visible_[k];
+      draw_.push(ps.x[i], ps.y[i], r);
+      ++stats_.individual;
+    }
+    for (const std::uint32_t c : touched_) {
+      Cell& cell = cells_[c];
+      if (cell.count >= params.merge_threshold) {
+        const double inv = 1.0 / cell.count;
+        // Same total area as the particles it stands for
+        draw_.push(cell.sx * inv, cell.sy * inv, r * std::sqrt(static_cast<double>(cell.count)));
+        ++stats_.impostors;
+        stats_.merged += cell.count;
+      }
+      cell = Cell{};
+    }
+    return draw_;
+  }
+
+  /// Build a grid over ps first, then cull
+  const ParticleDrawList& cull(const ParticleStore& ps, const CullParams& params) {
+    grid_.build(ps.x, ps.y);
+    return cull(ps, grid_, params);
+  }
+
+  [[nodiscard]] const ParticleDrawList& draw_list() const noexcept { return draw_; }
+  [[nodiscard]] const CullStats& stats() const noexcept { return stats_; }
+
+private:
+  struct Cell {
+    std::uint32_t count{0};
+    double sx{0.0};
+    double sy{0.0};
+  };
+
+  void bin(const ParticleStore& ps, const AABB& view, double lod_cell) {
+    const double inv = 1.0 / lod_cell;
+    const Vec2 size = view.upper - view.lower;
+    // Cap the dense array; very wide views just get coarser cells
+    constexpr double kMaxCells = 1 << 22;
+    double cell_inv = inv;
+    if ((size.x * inv + 1.0) * (size.y * inv + 1.0) > kMaxCells) {
+      cell_inv = std::sqrt(kMaxCells / ((size.x + lod_cell) * (size.y + lod_cell)));
+    }
+    // Snap cells to world multiples so panning does not reshuffle impostors
+    const Vec2 origin{std::floor(view.lower.x * cell_inv) / cell_inv,
+                      std::floor(view.lower.y * cell_inv) / cell_inv};
+    const int nx = static_cast<int>(std::ceil(size.x * cell_inv)) + 2;
+    const int ny = static_cast<int>(std::ceil(size.y * cell_inv)) + 2;
+    const std::size_t cells = static_cast<std::size_t>(nx) * static_cast<std::size_t>(ny);
+    if (cells_.size() < cells) cells_.resize(cells);
+
+    touched_.clear();
+    cell_ids_.resize(visible_.size());
+    for (std::size_t k = 0; k < visible_.size(); ++k) {
+      const std::uint32_t i = visible_[k];
+      const int cx = std::clamp(static_cast<int>((ps.x[i] - origin.x) * cell_inv), 0, nx - 1);
+      const int cy = std::clamp(static_cast<int>((ps.y[i] - origin.y) * cell_inv), 0, ny - 1);
+      const auto c = static_cast<std::uint32_t>(cy * nx + cx);
+      Cell& cell = cells_[c];
+      if (cell.count == 0) touched_.push_back(c);
+      ++cell.count;
+      cell.sx += ps.x[i];
+      cell.sy += ps.y[i];
+      cell_ids_[k] = c;
+    }
+  }
+
+  ParticleGrid grid_{0.5};
+  ParticleDrawList draw_;
+  CullStats stats_{};
+  std::vector<std::uint32_t> visible_;
+  std::vector<std::uint32_t> cell_ids_;   ///< LOD cell of visible_[k]
+  std::vector<std::uint32_t> touched_;
+  std::vector<Cell> cells_;
+};
+
+} // namespace sim
+
+#endif // SIM_PARTICLE_CULLING_HPP
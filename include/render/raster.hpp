@@ -0,0 +1,207 @@
+#pragma once
+#ifndef SIM_RASTER_HPP
+#define SIM_RASTER_HPP
+// include/render/raster.hpp
+// Pure-CPU rasterizer for headless frames: RGBA8 image, world-to-pixel
+// view, filled discs, convex polygons, lines and debug-draw batches
+//
+// Design notes:
+//  - No GL context or display needed, so validation videos render on
+//    build boxes; output is deterministic across machines
+//  - Pixel centres are at (i + 0.5, j + 0.5); row 0 is the top of the
+//    image, world +y points up
+//  - Coverage is binary (no anti-aliasing): frames are for inspection
+//    and diffing, not presentation
+
+#include "particle_culling.hpp"
+#include "../collision/polygon.hpp"
+#include "../debug/debug_draw.hpp"
+#include "../math/transform2.hpp"
+#include <algorithm>  // std::clamp, std::fill, std::max, std::min
+#include <cmath>      // std::ceil, std::cos, std::floor, std::sin, std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+struct Color {
+  std::uint8_t r{0}, g{0}, b{0}, a{255};
+};
+
+// -----------------------------
+// Image
+// -----------------------------
+/// Tightly packed RGBA8, row-major, top row first
+struct Image {
+  int width{0};
+  int height{0};
+  std::vector<std::uint8_t> pixels;
+
+  Image() = default;
+  Image(int w, int h) : width(w), height(h), pixels(static_cast<std::size_t>(w) * h * 4, 0) {}
+
+  [[nodiscard]] Color at(int x, int y) const noexcept {
+    const std::uint8_t* p = &pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+    return Color{p[0], p[1], p[2], p[3]};
+  }
+
+  void set(int x, int y, Color c) noexcept {
+    std::uint8_t* p = &pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+    p[0] = c.r;
+    p[1] = c.g;
+    p[2] = c.b;
+    p[3] = c.a;
+  }
+
+  /// Fill pixels [x0, x1) of row y
+  void fill_span(int y, int x0, int x1, Color c) noexcept {
+    for (int x = x0; x < x1; ++x) set(x, y, c);
+  }
+};
+
+// -----------------------------
+// View
+// -----------------------------
+/// Maps the world rectangle `world` onto a width x height image
+struct RasterView {
+  AABB world{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}};
+  int width{800};
+  int height{600};
+
+  [[nodiscard]] double sx() const noexcept { return width / (world.upper.x - world.lower.x); }
+  [[nodiscard]] double sy() const noexcept { return height / (world.upper.y - world.lower.y); }
+
+  [[nodiscard]] Vec2 to_pixel(const Vec2& w) const noexcept {
+    return Vec2{(w.x - world.lower.x) * sx(), (world.upper.y - w.y) * sy()};
+  }
+};
+
+// -----------------------------
+// Rasterizer
+// -----------------------------
+class Rasterizer {
+public:
+  explicit Rasterizer(const RasterView& view) : view_(view), image_(view.width, view.height) {}
+
+  void clear(Color c) {
+    for (int y = 0; y < image_.height; ++y) image_.fill_span(y, 0, image_.width, c);
+  }
+
+  /// Disc of world radius r (at least one pixel)
+  void fill_circle(const Vec2& center, double r, Color c) noexcept {
+    const Vec2 p = view_.to_pixel(center);
+    const double rx = std::max(r * view_.sx(), 0.5);
+    const double ry = std::max(r * view_.sy(), 0.5);
+    const int y0 = std::max(0, static_cast<int>(std::floor(p.y - ry)));
+    const int y1 = std::min(image_.height - 1, static_cast<int>(std::ceil(p.y + ry)));
+    for (int y = y0; y <= y1; ++y) {
+      const double dy = (y + 0.5 - p.y) / ry;
+      const double h = 1.0 - dy * dy;
+      if (h < 0.0) continue;
+      const double half = rx * std::sqrt(h);
+      fill_row(y, p.x - half, p.x + half, c);
+    }
+  }
+
+  /// Convex polygon in its local frame, placed by xf
+  void fill_polygon(const Polygon& poly, const Transform2& xf, Color c) noexcept {
+    if (poly.count < 3) return;
+    Vec2 pts[kMaxPolygonVertices];
+    double lo = 1e300, hi = -1e300;
+    for (int i = 0; i < poly.count; ++i) {
+      pts[i] = view_.to_pixel(xf.apply(poly.vertices[i]));
+      lo = std::min(lo, pts[i].y);
+      hi = std::max(hi, pts[i].y);
+    }
+    const int y0 = std::max(0, static_cast<int>(std::floor(lo)));
+    const int y1 = std::min(image_.height - 1, static_cast<int>(std::ceil(hi)));
+    for (int y = y0; y <= y1; ++y) {
+      // A convex polygon crosses each scanline in one span
+      const double yc = y + 0.5;
+      double xl = 1e300, xr = -1e300;
+      for (int i = 0; i < poly.count; ++i) {
+        const Vec2& a = pts[i];
+        const Vec2& b = pts[(i + 1) % poly.count];
+        if ((a.y <= yc) == (b.y <= yc)) continue;
+        const double x = a.x + (yc - a.y) / (b.y - a.y) * (b.x - a.x);
+        xl = std::min(xl, x);
+        xr = std::max(xr, x);
+      }
+      if (xl <= xr) fill_row(y, xl, xr, c);
+    }
+  }
+
+  /// One-pixel line (DDA)
+  void draw_line(const Vec2& a, const Vec2& b, Color c) noexcept {
+    const Vec2 pa = view_.to_pixel(a);
+    const Vec2 pb = view_.to_pixel(b);
+    const double steps = std::max({std::abs(pb.x - pa.x), std::abs(pb.y - pa.y), 1.0});
+    const int n = static_cast<int>(std::ceil(std::min(steps, 1e5)));
+    for (int k = 0; k <= n; ++k) plot(pa.lerp(pb, static_cast<double>(k) / n), c);
+  }
+
+  /// Every point of a culled draw list
+  void draw_particles(const ParticleDrawList& draw, Color c) noexcept {
+    for (std::size_t k = 0; k < draw.count(); ++k) {
+      fill_circle(Vec2{draw.x[k], draw.y[k]}, draw.size[k], c);
+    }
+  }
+
+  /// Merged debug-draw primitives, one pass per primitive type
+  void draw_debug(const DebugDrawBatch& batch) noexcept {
+    for (const DebugLine& l : batch.lines) {
+      draw_line(Vec2{l.x0, l.y0}, Vec2{l.x1, l.y1}, unpack(l.color));
+    }
+    for (const DebugCircle& c : batch.circles) {
+      constexpr int kSegments = 24;
+      const Vec2 center{c.x, c.y};
+      Vec2 prev = center + Vec2{c.radius, 0.0};
+      for (int k = 1; k <= kSegments; ++k) {
+        const double t = 6.283185307179586 * k / kSegments;
+        const Vec2 next = center + Vec2{std::cos(t), std::sin(t)} * static_cast<double>(c.radius);
+        draw_line(prev, next, unpack(c.color));
+        prev = next;
+      }
+    }
+    for (const DebugPoint& p : batch.points) {
+      fill_circle(Vec2{p.x, p.y}, 0.5 * p.size / view_.sx(), unpack(p.color));
+    }
+  }
+
+  [[nodiscard]] const Image& image() const noexcept { return image_; }
+  [[nodiscard]] Image& image() noexcept { return image_; }
+  [[nodiscard]] const RasterView& view() const noexcept { return view_; }
+
+private:
+  [[nodiscard]] static constexpr Color unpack(DebugColor c) noexcept {
+    return Color{static_cast<std::uint8_t>(c >> 24), static_cast<std::uint8_t>(c >> 16),
+                 static_cast<std::uint8_t>(c >> 8), static_cast<std::uint8_t>(c)};
+  }
+
+  /// Pixels whose centres lie in [x0, x1]
+  void fill_row(int y, double x0, double x1, Color c) noexcept {
+    const int a = std::max(0, static_cast<int>(std::ceil(x0 - 0.5)));
+    const int b = std::min(image_.width - 1, static_cast<int>(std::floor(x1 - 0.5)));
+    if (a > b) {
+      // Thinner than a pixel: keep it visible
+      const int x = static_cast<int>(std::floor(0.5 * (x0 + x1)));
+      if (x >= 0 && x < image_.width) image_.set(x, y, c);
+      return;
+    }
+    image_.fill_span(y, a, b + 1, c);
+  }
+
+  void plot(const Vec2& p, Color c) noexcept {
+    const int x = static_cast<int>(std::floor(p.x));
+    const int y = static_cast<int>(std::floor(p.y));
+    if (x >= 0 && y >= 0 && x < image_.width && y < image_.height) image_.set(x, y, c);
+  }
+
+  RasterView view_;
+  Image image_;
+};
+
+} // namespace sim
+
+#endif // SIM_RASTER_HPP
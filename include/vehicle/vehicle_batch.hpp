@@ -0,0 +1,335 @@
+#pragma once
+#ifndef SIM_VEHICLE_BATCH_HPP
+#define SIM_VEHICLE_BATCH_HPP
+// include/vehicle/vehicle_batch.hpp
+// Top-down vehicles: bicycle-model chassis, slip-based tyres and a
+// sub-stepped drivetrain, stored as one structure-of-arrays batch
+//
+// Design notes:
+//  - Each vehicle is a dedicated model, not bodies + joints: chassis
+//    (x, y, heading, body-frame velocity, yaw rate), one front and one
+//    rear axle, an engine driving the rear axle through a fixed ratio
+//  - Every per-vehicle quantity is its own contiguous column and the
+//    loop bodies avoid data-dependent branches (min/max/select only).
+//    Each phase is one straight-line kernel over __restrict column pointers,
+//    with the steering and heading trig computed in separate passes
+//    beforehand, so the drivetrain and chassis passes vectorise (sqrt
+//    needs -fno-math-errno, set for GCC/Clang in CMakeLists.txt)
+//  - Wheel spin is stiff (small inertia vs large tyre forces), so the
+//    drivetrain + longitudinal tyre forces run drivetrain_substeps times
+//    per world step; the chassis integrates once with averaged forces
+
+#include "../math/vec2.hpp"
+#include <algorithm>  // std::clamp, std::fill, std::max
+#include <cmath>      // std::cos, std::sin, std::sqrt
+#include <cstddef>
+#include <vector>
+
+namespace sim {
+
+// -----------------------------
+// Vehicle Parameters
+// -----------------------------
+struct VehicleParams {
+  double mass{1200.0};               ///< kg
+  double yaw_inertia{1800.0};        ///< kg m^2
+  double cg_to_front{1.2};           ///< m
+  double cg_to_rear{1.4};            ///< m
+  double wheel_radius{0.3};          ///< m
+  double wheel_inertia{1.5};         ///< per axle, kg m^2
+  double friction{1.0};              ///< tyre-road friction coefficient
+  double cornering_stiffness{8.0};   ///< normalised lateral slip stiffness
+  double slip_stiffness{12.0};       ///< normalised longitudinal slip stiffness
+  double max_engine_torque{400.0};   ///< N m at the engine
+  double gear_ratio{4.0};            ///< engine -> rear axle
+  double max_brake_torque{3000.0};   ///< N m per axle
+  double max_steer{0.6};             ///< rad
+  double drag{0.4};                  ///< aerodynamic drag coefficient (N s^2/m^2)
+};
+
+struct VehicleInput {
+  double throttle{0.0};  ///< [0, 1]
+  double brake{0.0};     ///< [0, 1]
+  double steer{0.0};     ///< [-1, 1], positive turns left
+};
+
+// -----------------------------
+// Vehicle Batch
+// -----------------------------
+class VehicleBatch {
+public:
+  static constexpr double kGravity = 9.81;
+
+  /// Add a vehicle at rest; returns its index
+  std::size_t add(const VehicleParams& p, const Vec2& position, double heading = 0.0) {
+    const std::size_t i = x.size();
+    auto push = [](std::vector<double>& col, double v) { col.push_back(v); };
+    push(x, position.x);
+    push(y, position.y);
+    push(heading_, heading);
+    push(vx, 0.0);
+    push(vy, 0.0);
+    push(yaw_rate, 0.0);
+    push(front_spin, 0.0);
+    push(rear_spin, 0.0);
+    push(throttle, 0.0);
+    push(brake, 0.0);
+    push(steer, 0.0);
+
+    push(inv_mass_, 1.0 / p.mass);
+    push(inv_yaw_inertia_, 1.0 / p.yaw_inertia);
+    push(cg_front_, p.cg_to_front);
+    push(cg_rear_, p.cg_to_rear);
+    push(radius_, p.wheel_radius);
+    push(inv_wheel_inertia_, 1.0 / p.wheel_inertia);
+    push(friction_, p.friction);
+    push(cornering_, p.cornering_stiffness);
+    push(slip_, p.slip_stiffness);
+    push(drive_torque_, p.max_engine_torque * p.gear_ratio);
+    push(brake_torque_, p.max_brake_torque);
+    push(max_steer_, p.max_steer);
+    push(drag_, p.drag);
+
+    // Static axle loads from the weight distribution
+    const double wheelbase = p.cg_to_front + p.cg_to_rear;
+    push(load_front_, p.mass * kGravity * p.cg_to_rear / wheelbase);
+    push(load_rear_, p.mass * kGravity * p.cg_to_front / wheelbase);
+
+    for (auto* col : {&fx_front_, &fy_front_, &fx_rear_, &fy_rear_, &steer_cos_, &steer_sin_,
+                      &heading_cos_, &heading_sin_}) {
+      col->push_back(0.0);
+    }
+    return i;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return x.size(); }
+
+  void set_input(std::size_t i, const VehicleInput& in) noexcept {
+    throttle[i] = std::clamp(in.throttle, 0.0, 1.0);
+    brake[i] = std::clamp(in.brake, 0.0, 1.0);
+    steer[i] = std::clamp(in.steer, -1.0, 1.0);
+  }
+
+  [[nodiscard]] Vec2 position(std::size_t i) const noexcept { return Vec2{x[i], y[i]}; }
+  [[nodiscard]] double heading(std::size_t i) const noexcept { return heading_[i]; }
+
+  /// World-frame velocity of the chassis
+  [[nodiscard]] Vec2 velocity(std::size_t i) const noexcept {
+    const double c = std::cos(heading_[i]);
+    const double s = std::sin(heading_[i]);
+    return Vec2{c * vx[i] - s * vy[i], s * vx[i] + c * vy[i]};
+  }
+
+  /// Advance every vehicle by dt; the drivetrain takes substeps per step
+  void step(double dt, int drivetrain_substeps = 8) {
+    const int substeps = std::max(drivetrain_substeps, 1);
+    const double h = dt / substeps;
+    const double inv_substeps = 1.0 / substeps;
+
+    // Steering is fixed for the step: its trig runs once, outside the
+    // phase loops, where a libm call would stop them vectorising
+    for (std::size_t i = 0; i < size(); ++i) {
+      const double angle = steer[i] * max_steer_[i];
+      steer_cos_[i] = std::cos(angle);
+      steer_sin_[i] = std::sin(angle);
+    }
+
+    std::fill(fx_front_.begin(), fx_front_.end(), 0.0);
+    std::fill(fy_front_.begin(), fy_front_.end(), 0.0);
+    std::fill(fx_rear_.begin(), fx_rear_.end(), 0.0);
+    std::fill(fy_rear_.begin(), fy_rear_.end(), 0.0);
+
+    for (int s = 0; s < substeps; ++s) drivetrain_pass(h, inv_substeps);
+    chassis_velocity_pass(dt);
+
+    for (std::size_t i = 0; i < size(); ++i) {
+      heading_cos_[i] = std::cos(heading_[i]);
+      heading_sin_[i] = std::sin(heading_[i]);
+    }
+    chassis_position_pass(dt);
+  }
+
+  // Chassis state (body frame velocities: vx forward, vy left)
+  std::vector<double> x, y, vx, vy, yaw_rate;
+  // Wheel angular velocity per axle (rad/s)
+  std::vector<double> front_spin, rear_spin;
+  // Driver inputs
+  std::vector<double> throttle, brake, steer;
+
+private:
+  /// Normalised tyre response: linear for small slip, saturating at 1
+  [[nodiscard]] static double tyre_curve(double slip) noexcept {
+    return slip / std::sqrt(1.0 + slip * slip);
+  }
+
+  /// Derivative of tyre_curve
+  [[nodiscard]] static double tyre_slope(double slip) noexcept {
+    const double d = 1.0 + slip * slip;
+    return 1.0 / (d * std::sqrt(d));
+  }
+
+  /// Brakes reduce |spin| by up to dw without reversing it
+  [[nodiscard]] static double apply_brake(double spin, double dw) noexcept {
+    const double mag = std::max(std::abs(spin) - dw, 0.0);
+    return spin >= 0.0 ? mag : -mag;
+  }
+
+  // Each pass hands raw column pointers to a static kernel whose
+  // parameters are __restrict: the columns never overlap, and without the
+  // promise the compiler must assume any store may change any column
+
+  /// One drivetrain substep for every vehicle; accumulates averaged forces
+  void drivetrain_pass(double h, double weight) noexcept {
+    drivetrain_kernel(size(), h, weight, vx.data(), vy.data(), yaw_rate.data(), throttle.data(),
+                      brake.data(), steer_cos_.data(), steer_sin_.data(), cg_front_.data(),
+                      cg_rear_.data(), radius_.data(), inv_wheel_inertia_.data(), friction_.data(),
+                      cornering_.data(), slip_.data(), drive_torque_.data(), brake_torque_.data(),
+                      load_front_.data(), load_rear_.data(), front_spin.data(), rear_spin.data(),
+                      fx_front_.data(), fy_front_.data(), fx_rear_.data(), fy_rear_.data());
+  }
+
+  static void drivetrain_kernel(
+      std::size_t n, double h, double weight,
+      const double* __restrict vx, const double* __restrict vy, const double* __restrict yaw_rate,
+      const double* __restrict throttle, const double* __restrict brake,
+      const double* __restrict steer_cos, const double* __restrict steer_sin,
+      const double* __restrict cg_front, const double* __restrict cg_rear,
+      const double* __restrict radius, const double* __restrict inv_wheel_inertia,
+      const double* __restrict friction, const double* __restrict cornering,
+      const double* __restrict slip, const double* __restrict drive_torque,
+      const double* __restrict brake_torque, const double* __restrict load_front,
+      const double* __restrict load_rear, double* __restrict front_spin,
+      double* __restrict rear_spin, double* __restrict fx_front, double* __restrict fy_front,
+      double* __restrict fx_rear, double* __restrict fy_rear) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double cs = steer_cos[i];
+      const double sn = steer_sin[i];
+
+      // Contact patch velocities in the chassis frame
+      const double front_vx = vx[i];
+      const double front_vy = vy[i] + yaw_rate[i] * cg_front[i];
+      const double rear_vx = vx[i];
+      const double rear_vy = vy[i] - yaw_rate[i] * cg_rear[i];
+
+      // Front velocities in the steered wheel frame
+      const double fw_long = cs * front_vx + sn * front_vy;
+      const double fw_lat = -sn * front_vx + cs * front_vy;
+
+      // Slip ratio and slip angle (regularised near standstill)
+      constexpr double k_min_speed = 0.5;
+      const double f_ref = std::max(std::abs(fw_long), k_min_speed);
+      const double r_ref = std::max(std::abs(rear_vx), k_min_speed);
+      const double f_ratio = (front_spin[i] * radius[i] - fw_long) / f_ref;
+      const double r_ratio = (rear_spin[i] * radius[i] - rear_vx) / r_ref;
+      const double f_alpha = -fw_lat / f_ref;
+      const double r_alpha = -rear_vy / r_ref;
+
+      // Combined slip on a friction circle: direction from the slip
+      // vector, magnitude from the saturating curve
+      const double f_sx = slip[i] * f_ratio;
+      const double f_sy = cornering[i] * f_alpha;
+      const double r_sx = slip[i] * r_ratio;
+      const double r_sy = cornering[i] * r_alpha;
+      const double f_mag = std::sqrt(f_sx * f_sx + f_sy * f_sy);
+      const double r_mag = std::sqrt(r_sx * r_sx + r_sy * r_sy);
+      const double f_scale = friction[i] * load_front[i] * tyre_curve(f_mag) / std::max(f_mag, 1e-9);
+      const double r_scale = friction[i] * load_rear[i] * tyre_curve(r_mag) / std::max(r_mag, 1e-9);
+      const double f_long = f_sx * f_scale;
+      const double f_lat = f_sy * f_scale;
+      const double r_long = r_sx * r_scale;
+      const double r_lat = r_sy * r_scale;
+
+      // Wheel spin: engine drives the rear axle, brakes oppose rotation,
+      // road reaction opposes the longitudinal tyre force. The reaction
+      // is linearised in spin (implicit Euler) so low-speed slip stays
+      // stable
+      const double r = radius[i];
+      const double inv_iw = inv_wheel_inertia[i];
+      const double f_stiff = friction[i] * load_front[i] * slip[i] * r / f_ref * tyre_slope(f_mag);
+      const double r_stiff = friction[i] * load_rear[i] * slip[i] * r / r_ref * tyre_slope(r_mag);
+      const double drive = throttle[i] * drive_torque[i];
+      const double brake_dw = brake[i] * brake_torque[i] * inv_iw * h;
+      const double front_torque = -f_long * r;
+      const double rear_torque = drive - r_long * r;
+      front_spin[i] = apply_brake(
+        front_spin[i] + h * inv_iw * front_torque / (1.0 + h * inv_iw * r * f_stiff), brake_dw);
+      rear_spin[i] = apply_brake(
+        rear_spin[i] + h * inv_iw * rear_torque / (1.0 + h * inv_iw * r * r_stiff), brake_dw);
+
+      // Front forces back into the chassis frame, averaged over substeps
+      fx_front[i] += weight * (cs * f_long - sn * f_lat);
+      fy_front[i] += weight * (sn * f_long + cs * f_lat);
+      fx_rear[i] += weight * r_long;
+      fy_rear[i] += weight * r_lat;
+    }
+  }
+
+  /// Chassis velocities and heading from the averaged axle forces
+  void chassis_velocity_pass(double dt) noexcept {
+    chassis_velocity_kernel(size(), dt, fx_front_.data(), fy_front_.data(), fx_rear_.data(),
+                            fy_rear_.data(), drag_.data(), cg_front_.data(), cg_rear_.data(),
+                            inv_mass_.data(), inv_yaw_inertia_.data(), vx.data(), vy.data(),
+                            yaw_rate.data(), heading_.data());
+  }
+
+  static void chassis_velocity_kernel(
+      std::size_t n, double dt,
+      const double* __restrict fx_front, const double* __restrict fy_front,
+      const double* __restrict fx_rear, const double* __restrict fy_rear,
+      const double* __restrict drag, const double* __restrict cg_front,
+      const double* __restrict cg_rear, const double* __restrict inv_mass,
+      const double* __restrict inv_yaw_inertia, double* __restrict vx, double* __restrict vy,
+      double* __restrict yaw_rate, double* __restrict heading) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double speed = std::sqrt(vx[i] * vx[i] + vy[i] * vy[i]);
+      const double drag_x = -drag[i] * vx[i] * speed;
+      const double drag_y = -drag[i] * vy[i] * speed;
+
+      const double fx = fx_front[i] + fx_rear[i] + drag_x;
+      const double fy = fy_front[i] + fy_rear[i] + drag_y;
+      const double torque = cg_front[i] * fy_front[i] - cg_rear[i] * fy_rear[i];
+
+      // Body-frame equations include the rotating-frame terms
+      vx[i] += dt * (fx * inv_mass[i] + yaw_rate[i] * vy[i]);
+      vy[i] += dt * (fy * inv_mass[i] - yaw_rate[i] * vx[i]);
+      yaw_rate[i] += dt * torque * inv_yaw_inertia[i];
+      heading[i] += dt * yaw_rate[i];
+    }
+  }
+
+  /// Positions from the new velocities, rotated by the new heading
+  void chassis_position_pass(double dt) noexcept {
+    chassis_position_kernel(size(), dt, vx.data(), vy.data(), heading_cos_.data(),
+                            heading_sin_.data(), x.data(), y.data());
+  }
+
+  static void chassis_position_kernel(std::size_t n, double dt, const double* __restrict vx,
+                                      const double* __restrict vy, const double* __restrict c,
+                                      const double* __restrict s, double* __restrict x,
+                                      double* __restrict y) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] += dt * (c[i] * vx[i] - s[i] * vy[i]);
+      y[i] += dt * (s[i] * vx[i] + c[i] * vy[i]);
+    }
+  }
+
+  std::vector<double> heading_;
+
+  // Per-vehicle parameters
+  std::vector<double> inv_mass_, inv_yaw_inertia_;
+  std::vector<double> cg_front_, cg_rear_;
+  std::vector<double> radius_, inv_wheel_inertia_;
+  std::vector<double> friction_, cornering_, slip_;
+  std::vector<double> drive_torque_, brake_torque_, max_steer_, drag_;
+  std::vector<double> load_front_, load_rear_;
+
+  // Substep-averaged axle forces (chassis frame)
+  std::vector<double> fx_front_, fy_front_, fx_rear_, fy_rear_;
+
+  // Per-step trig, computed ahead of the passes that use it
+  std::vector<double> steer_cos_, steer_sin_, heading_cos_, heading_sin_;
+};
+
+} // namespace sim
+
+#endif // SIM_VEHICLE_BATCH_HPP
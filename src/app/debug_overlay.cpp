@@ -0,0 +1,50 @@
+#include "debug_overlay.hpp"
+
+#include <imgui.h>
+
+#include <algorithm>
+
+namespace {
+
+ImU32 to_imgui(sim::DebugColor c) {
+    return IM_COL32((c >> 24) & 0xFF, (c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF);
+}
+
+} // namespace
+
+void draw_debug_overlay(DebugOverlay& overlay, SimThread& sim_thread) {
+    if (ImGui::BeginMainMenuBar()) {
+        if (ImGui::BeginMenu("View")) {
+            ImGui::MenuItem("Debug draw", nullptr, &overlay.enabled, sim::DebugDraw::enabled);
+            ImGui::EndMenu();
+        }
+        ImGui::EndMainMenuBar();
+    }
+    sim_thread.set_debug_draw(overlay.enabled);
+    if (!overlay.enabled) return;
+
+    sim::PublishedState<sim::DebugDrawBatch>& batches = sim_thread.debug_batches();
+    batches.acquire();
+    const sim::DebugDrawBatch& batch = batches.read_buffer();
+
+    // Uniform scale that fits the world region, y up
+    const ImVec2 display = ImGui::GetIO().DisplaySize;
+    const float ww = static_cast<float>(overlay.world.upper.x - overlay.world.lower.x);
+    const float wh = static_cast<float>(overlay.world.upper.y - overlay.world.lower.y);
+    const float scale = std::min(display.x / ww, display.y / wh);
+    const float ox = 0.5f * (display.x - ww * scale) - static_cast<float>(overlay.world.lower.x) * scale;
+    const float oy = 0.5f * (display.y + wh * scale) + static_cast<float>(overlay.world.lower.y) * scale;
+    auto to_screen = [&](float x, float y) { return ImVec2(ox + x * scale, oy - y * scale); };
+
+    // One pass per primitive type, matching the batch layout
+    ImDrawList* draw = ImGui::GetBackgroundDrawList();
+    for (const sim::DebugLine& l : batch.lines) {
+        draw->AddLine(to_screen(l.x0, l.y0), to_screen(l.x1, l.y1), to_imgui(l.color));
+    }
+    for (const sim::DebugCircle& c : batch.circles) {
+        draw->AddCircle(to_screen(c.x, c.y), c.radius * scale, to_imgui(c.color));
+    }
+    for (const sim::DebugPoint& p : batch.points) {
+        draw->AddCircleFilled(to_screen(p.x, p.y), 0.5f * p.size, to_imgui(p.color));
+    }
+}
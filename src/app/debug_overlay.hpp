@@ -0,0 +1,14 @@
+#pragma once
+// src/app/debug_overlay.hpp
+// Renders the simulation's merged debug-draw batch over the window
+
+#include "demo_world.hpp"
+
+struct DebugOverlay {
+    bool enabled = false;
+    sim::AABB world{sim::Vec2{-8.0, -1.0}, sim::Vec2{8.0, 11.0}};  ///< visible region
+};
+
+/// Draw the debug-draw menu toggle and, when enabled, the newest batch from
+/// the sim thread on ImGui's background draw list
+void draw_debug_overlay(DebugOverlay& overlay, SimThread& sim_thread);
@@ -0,0 +1,111 @@
+#include "demo_world.hpp"
+
+#include <chrono>
+
+DemoWorld::DemoWorld() {
+    // Static ground, then a few columns of boxes
+    add_box(sim::Vec2{0.0, -0.5}, 20.0, 0.5, 0.0);
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 6; ++row) {
+            add_box(sim::Vec2{-3.0 + 2.0 * column, 0.5 + 1.05 * row}, 0.5, 0.5, 1.0);
+        }
+    }
+    caches_.resize(bodies_.size() * bodies_.size());
+}
+
+void DemoWorld::add_box(const sim::Vec2& position, double hw, double hh, double density) {
+    sim::RigidBody body;
+    body.position = position;
+    const sim::Polygon shape = sim::make_box(hw, hh);
+    if (density > 0.0) {
+        const sim::MassData md = sim::compute_mass(shape, density);
+        body.inv_mass = 1.0 / md.mass;
+        body.inv_inertia = 1.0 / md.inertia;
+    }
+    bodies_.push_back(body);
+    shapes_.push_back(shape);
+}
+
+template<bool DebugDrawOn>
+void DemoWorld::step(double dt, sim::InspectorCapture& capture,
+                     sim::BasicDebugDraw<DebugDrawOn>& debug) {
+    capture.begin_step();
+    const sim::Vec2 gravity{0.0, -9.81};
+
+    {
+        sim::InspectorPhase phase(capture, "integrate velocities");
+        sim::integrate_velocities(bodies_, gravity, dt);
+    }
+
+    {
+        sim::InspectorPhase phase(capture, "narrowphase");
+        solver_.clear();
+        const std::size_t n = bodies_.size();
+        for (std::size_t a = 0; a < n; ++a) {
+            for (std::size_t b = a + 1; b < n; ++b) {
+                if (bodies_[a].is_static() && bodies_[b].is_static()) continue;
+                const sim::Manifold m = sim::collide_polygons(
+                    shapes_[a], bodies_[a].transform(), shapes_[b], bodies_[b].transform(),
+                    caches_[a * n + b], sim::kLinearSlop);
+                if (m.empty()) continue;
+                debug.thread().manifold(m);
+                sim::ContactConstraint& c = solver_.add(static_cast<int>(a), static_cast<int>(b), m,
+                                                        bodies_, materials_);
+                for (const sim::ContactConstraint& p : previous_) {
+                    if (p.body_a == c.body_a && p.body_b == c.body_b) {
+                        sim::ContactSolver::match_impulses(c, p);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        sim::InspectorPhase phase(capture, "solve");
+        solver_.solve(bodies_, dt, 8);
+    }
+
+    {
+        sim::InspectorPhase phase(capture, "integrate positions");
+        sim::integrate_positions(bodies_, dt);
+    }
+
+    for (std::size_t i = 0; i < bodies_.size(); ++i) {
+        debug.thread().polygon(shapes_[i], bodies_[i].transform());
+    }
+
+    previous_.assign(solver_.constraints().begin(), solver_.constraints().end());
+    capture.capture_bodies(bodies_);
+    capture.capture_contacts(solver_.constraints());
+    capture.end_step(++steps_);
+}
+
+template void DemoWorld::step<true>(double, sim::InspectorCapture&, sim::BasicDebugDraw<true>&);
+template void DemoWorld::step<false>(double, sim::InspectorCapture&, sim::BasicDebugDraw<false>&);
+
+SimThread::SimThread(sim::InspectorCapture& capture)
+    : capture_(capture), thread_([this] { run(); }) {}
+
+SimThread::~SimThread() {
+    running_.store(false);
+    thread_.join();
+}
+
+void SimThread::run() {
+    using clock = std::chrono::steady_clock;
+    constexpr double kDt = 1.0 / 60.0;
+    auto next = clock::now();
+    while (running_.load(std::memory_order_relaxed)) {
+        if (sim::DebugDraw::enabled && debug_on_.load(std::memory_order_relaxed)) {
+            debug_.begin_frame();
+            world_.step(kDt, capture_, debug_);
+            debug_batches_.write_buffer() = debug_.merge();
+            debug_batches_.publish();
+        } else {
+            world_.step(kDt, capture_, no_debug_);
+        }
+        next += std::chrono::microseconds(16667);
+        std::this_thread::sleep_until(next);
+    }
+}
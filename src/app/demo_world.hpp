@@ -0,0 +1,69 @@
+#pragma once
+// src/app/demo_world.hpp
+// Small box-stacking world stepped on its own thread for the windowed app
+
+#include "collision/polygon.hpp"
+#include "collision/sat.hpp"
+#include "core/published_state.hpp"
+#include "debug/debug_draw.hpp"
+#include "debug/inspector.hpp"
+#include "dynamics/contact_solver.hpp"
+#include "dynamics/material.hpp"
+#include "dynamics/rigid_body.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+class DemoWorld {
+public:
+    DemoWorld();
+
+    /// One fixed step; fills the inspector capture when panels are open
+    /// and records shapes and contacts into the debug draw. The <false>
+    /// instantiation contains no debug-draw code at all.
+    template<bool DebugDrawOn>
+    void step(double dt, sim::InspectorCapture& capture, sim::BasicDebugDraw<DebugDrawOn>& debug);
+
+    [[nodiscard]] std::uint64_t steps() const { return steps_; }
+
+private:
+    void add_box(const sim::Vec2& position, double hw, double hh, double density);
+
+    std::vector<sim::RigidBody> bodies_;
+    std::vector<sim::Polygon> shapes_;
+    std::vector<sim::SatCache> caches_;          // one per body pair, row-major
+    std::vector<sim::ContactConstraint> previous_;
+    sim::ContactSolver solver_;
+    sim::MaterialTable materials_;
+    std::uint64_t steps_ = 0;
+};
+
+/// Runs a DemoWorld at a fixed rate until stopped
+class SimThread {
+public:
+    explicit SimThread(sim::InspectorCapture& capture);
+    ~SimThread();
+
+    SimThread(const SimThread&) = delete;
+    SimThread& operator=(const SimThread&) = delete;
+
+    /// UI thread: turn debug-draw publishing on or off
+    void set_debug_draw(bool on) { debug_on_.store(on, std::memory_order_relaxed); }
+
+    /// UI thread: newest debug-draw batch (see PublishedState::acquire)
+    sim::PublishedState<sim::DebugDrawBatch>& debug_batches() { return debug_batches_; }
+
+private:
+    void run();
+
+    sim::InspectorCapture& capture_;
+    DemoWorld world_;
+    sim::DebugDraw debug_;
+    sim::BasicDebugDraw<false> no_debug_;
+    sim::PublishedState<sim::DebugDrawBatch> debug_batches_;
+    std::atomic<bool> debug_on_{false};
+    std::atomic<bool> running_{true};
+    std::thread thread_;
+};
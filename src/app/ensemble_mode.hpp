@@ -0,0 +1,22 @@
+#pragma once
+// src/app/ensemble_mode.hpp
+// Batch run mode: many small particle worlds in one process, one CSV row
+// of summary output per world
+
+#include <cstdint>
+#include <string>
+
+struct EnsembleOptions {
+    std::uint32_t worlds = 256;
+    std::uint32_t particles = 1000;
+    int steps = 600;
+    std::uint32_t seed = 1;          // world i uses seed + i
+    unsigned threads = 0;            // 0: one per hardware thread
+    std::string out;                 // CSV path; empty writes to stdout
+};
+
+/// Parse --ensemble options; returns false (after printing usage) on bad input
+bool parse_ensemble_options(int argc, char** argv, EnsembleOptions& opts);
+
+/// Run the ensemble; returns the process exit code
+int run_ensemble(const EnsembleOptions& opts);
@@ -0,0 +1,138 @@
+#include "headless.hpp"
+
+#include "core/xorshift.hpp"
+#include "particles/particle_store.hpp"
+#include "render/frame_writer.hpp"
+#include "render/particle_culling.hpp"
+#include "render/raster.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+void print_usage() {
+    std::fprintf(stderr,
+                 "usage: sim_app --headless [--frames N] [--size WxH] [--out PREFIX]\n"
+                 "                          [--format png|ppm] [--particles N]\n");
+}
+
+// Particles dropped into a box; enough motion to make a useful video
+void seed_particles(sim::ParticleStore& ps, std::uint32_t count) {
+    ps.reserve(count);
+    sim::XorShift32 rng(0x9E3779B9u);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const sim::Vec2 p{rng.uniform(-4.0, 4.0), rng.uniform(2.0, 8.0)};
+        const sim::Vec2 v{rng.uniform(-1.0, 1.0), 0.0};
+        ps.add(p, v, 1.0);
+    }
+}
+
+// Bounce off the walls and floor of the [-8, 8] x [-6, inf) box
+void confine(sim::ParticleStore& ps) {
+    constexpr double kRestitution = 0.5;
+    for (std::size_t i = 0; i < ps.size(); ++i) {
+        if (ps.y[i] < -6.0) {
+            ps.y[i] = -6.0;
+            ps.vy[i] = -ps.vy[i] * kRestitution;
+        }
+        if (ps.x[i] < -8.0 || ps.x[i] > 8.0) {
+            ps.x[i] = ps.x[i] < 0.0 ? -8.0 : 8.0;
+            ps.vx[i] = -ps.vx[i] * kRestitution;
+        }
+    }
+}
+
+} // namespace
+
+bool parse_headless_options(int argc, char** argv, HeadlessOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (std::strcmp(arg, "--headless") == 0) continue;
+        if (value == nullptr) {
+            print_usage();
+            return false;
+        }
+        ++i;
+        if (std::strcmp(arg, "--frames") == 0) {
+            opts.frames = std::atoi(value);
+        } else if (std::strcmp(arg, "--size") == 0) {
+            if (std::sscanf(value, "%dx%d", &opts.width, &opts.height) != 2) {
+                print_usage();
+                return false;
+            }
+        } else if (std::strcmp(arg, "--out") == 0) {
+            opts.out_prefix = value;
+        } else if (std::strcmp(arg, "--format") == 0) {
+            if (std::strcmp(value, "png") == 0) {
+                opts.png = true;
+            } else if (std::strcmp(value, "ppm") == 0) {
+                opts.png = false;
+            } else {
+                print_usage();
+                return false;
+            }
+        } else if (std::strcmp(arg, "--particles") == 0) {
+            opts.particles = static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10));
+        } else {
+            print_usage();
+            return false;
+        }
+    }
+    if (opts.frames <= 0 || opts.width <= 0 || opts.height <= 0) {
+        print_usage();
+        return false;
+    }
+    return true;
+}
+
+int run_headless(const HeadlessOptions& opts) {
+    constexpr double kDt = 1.0 / 60.0;
+    const sim::Vec2 gravity{0.0, -9.81};
+
+    sim::ParticleStore ps;
+    seed_particles(ps, opts.particles);
+
+    sim::RasterView view;
+    view.width = opts.width;
+    view.height = opts.height;
+    const double aspect = static_cast<double>(opts.width) / opts.height;
+    view.world = sim::AABB{sim::Vec2{-9.0 * aspect / (4.0 / 3.0), -7.0},
+                           sim::Vec2{9.0 * aspect / (4.0 / 3.0), 9.0}};
+
+    sim::ParticleCuller culler;
+    sim::CullParams cull;
+    cull.view = view.world;
+    cull.pixels_per_unit = view.sx();
+    cull.particle_radius = 0.03;
+
+    const sim::ImageFormat format = opts.png ? sim::ImageFormat::png : sim::ImageFormat::ppm;
+    sim::FrameWriter writer(opts.out_prefix, format);
+
+    for (int frame = 0; frame < opts.frames; ++frame) {
+        sim::integrate_particles(ps, gravity, kDt);
+        confine(ps);
+
+        sim::Rasterizer raster(view);
+        raster.clear(sim::Color{18, 18, 24, 255});
+        raster.draw_line(sim::Vec2{-8.0, -6.0}, sim::Vec2{8.0, -6.0}, sim::Color{200, 200, 200, 255});
+        raster.draw_particles(culler.cull(ps, cull), sim::Color{90, 170, 255, 255});
+        writer.submit(std::move(raster.image()));
+    }
+    writer.flush();
+
+    const sim::FrameWriterStats stats = writer.stats();
+    std::printf("headless: wrote %llu frames (%llu bytes) to %s*%s\n",
+                static_cast<unsigned long long>(stats.written),
+                static_cast<unsigned long long>(stats.bytes), opts.out_prefix.c_str(),
+                sim::extension(format));
+    if (stats.failed > 0) {
+        std::fprintf(stderr, "headless: %llu frames failed to write\n",
+                     static_cast<unsigned long long>(stats.failed));
+        return 1;
+    }
+    return 0;
+}
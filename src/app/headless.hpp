@@ -0,0 +1,21 @@
+#pragma once
+// src/app/headless.hpp
+// Offscreen run mode: simulate, rasterize on the CPU, write image frames
+
+#include <cstdint>
+#include <string>
+
+struct HeadlessOptions {
+    int frames = 120;
+    int width = 800;
+    int height = 600;
+    std::string out_prefix = "frame_";
+    bool png = true;                 // false: binary PPM
+    std::uint32_t particles = 20000;
+};
+
+/// Parse --headless options; returns false (after printing usage) on bad input
+bool parse_headless_options(int argc, char** argv, HeadlessOptions& opts);
+
+/// Run without a window; returns the process exit code
+int run_headless(const HeadlessOptions& opts);
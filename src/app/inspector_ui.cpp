@@ -0,0 +1,144 @@
+#include "inspector_ui.hpp"
+
+#include <imgui.h>
+
+#include <cfloat>
+#include <cstdio>
+
+namespace {
+
+void draw_bodies(InspectorUi& ui, const sim::InspectorFrame& frame) {
+    if (!ImGui::Begin("Bodies", &ui.show_bodies)) {
+        ImGui::End();
+        return;
+    }
+    ImGui::Text("step %llu, %zu bodies", static_cast<unsigned long long>(frame.step),
+                frame.bodies.size());
+    if (ImGui::BeginTable("body_list", 4,
+                          ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders,
+                          ImVec2(0.0f, 240.0f))) {
+        ImGui::TableSetupColumn("#");
+        ImGui::TableSetupColumn("position");
+        ImGui::TableSetupColumn("velocity");
+        ImGui::TableSetupColumn("mass");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(frame.bodies.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const sim::BodyRow& b = frame.bodies[static_cast<std::size_t>(i)];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                char label[16];
+                std::snprintf(label, sizeof(label), "%u", b.index);
+                if (ImGui::Selectable(label, ui.selected_body == i,
+                                      ImGuiSelectableFlags_SpanAllColumns)) {
+                    ui.selected_body = i;
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f, %.3f", b.position.x, b.position.y);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f, %.3f", b.linear_velocity.x, b.linear_velocity.y);
+                ImGui::TableNextColumn();
+                if (b.inv_mass > 0.0) {
+                    ImGui::Text("%.3f", 1.0 / b.inv_mass);
+                } else {
+                    ImGui::TextUnformatted("static");
+                }
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    if (ui.selected_body >= 0 && static_cast<std::size_t>(ui.selected_body) < frame.bodies.size()) {
+        const sim::BodyRow& b = frame.bodies[static_cast<std::size_t>(ui.selected_body)];
+        ImGui::SeparatorText("Selected body");
+        ImGui::Text("index            %u", b.index);
+        ImGui::Text("position         %.4f, %.4f", b.position.x, b.position.y);
+        ImGui::Text("angle            %.4f rad", b.angle);
+        ImGui::Text("linear velocity  %.4f, %.4f", b.linear_velocity.x, b.linear_velocity.y);
+        ImGui::Text("angular velocity %.4f rad/s", b.angular_velocity);
+        ImGui::Text("inverse mass     %.4f", b.inv_mass);
+        ImGui::Text("material         %u", static_cast<unsigned>(b.material));
+    }
+    ImGui::End();
+}
+
+void draw_contacts(InspectorUi& ui, const sim::InspectorFrame& frame) {
+    if (!ImGui::Begin("Contacts", &ui.show_contacts)) {
+        ImGui::End();
+        return;
+    }
+    ImGui::Text("%zu manifolds", frame.contacts.size());
+    if (ImGui::BeginTable("contact_list", 5,
+                          ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)) {
+        ImGui::TableSetupColumn("bodies");
+        ImGui::TableSetupColumn("normal");
+        ImGui::TableSetupColumn("points");
+        ImGui::TableSetupColumn("normal impulse");
+        ImGui::TableSetupColumn("separation");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(frame.contacts.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const sim::ContactRow& c = frame.contacts[static_cast<std::size_t>(i)];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%d - %d", c.body_a, c.body_b);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f, %.2f", c.normal.x, c.normal.y);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", c.points);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.4f", c.normal_impulse);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.4f", c.min_separation);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+void draw_timings(InspectorUi& ui) {
+    if (!ImGui::Begin("Timings", &ui.show_timings)) {
+        ImGui::End();
+        return;
+    }
+    const sim::TimingHistory<>& h = ui.history;
+    for (int p = 0; p < h.phase_count(); ++p) {
+        char overlay[48];
+        std::snprintf(overlay, sizeof(overlay), "%.3f ms", h.latest(p));
+        ImGui::PlotLines(h.name(p), h.samples(p), static_cast<int>(h.size()), h.offset(), overlay,
+                         0.0f, FLT_MAX, ImVec2(0.0f, 48.0f));
+    }
+    ImGui::End();
+}
+
+} // namespace
+
+void draw_inspector(InspectorUi& ui, sim::InspectorCapture& capture) {
+    if (ImGui::BeginMainMenuBar()) {
+        if (ImGui::BeginMenu("Inspector")) {
+            ImGui::MenuItem("Bodies", nullptr, &ui.show_bodies);
+            ImGui::MenuItem("Contacts", nullptr, &ui.show_contacts);
+            ImGui::MenuItem("Timings", nullptr, &ui.show_timings);
+            ImGui::EndMenu();
+        }
+        ImGui::EndMainMenuBar();
+    }
+
+    if (capture.acquire()) ui.history.push(capture.frame());
+    const sim::InspectorFrame& frame = capture.frame();
+    if (ui.show_bodies) draw_bodies(ui, frame);
+    if (ui.show_contacts) draw_contacts(ui, frame);
+    if (ui.show_timings) draw_timings(ui);
+
+    // Closing a panel stops its capture on the sim thread from the next step
+    std::uint32_t panels = sim::kPanelNone;
+    if (ui.show_bodies) panels |= sim::kPanelBodies;
+    if (ui.show_contacts) panels |= sim::kPanelContacts;
+    if (ui.show_timings) panels |= sim::kPanelTimings;
+    capture.set_open_panels(panels);
+}
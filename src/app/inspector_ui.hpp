@@ -0,0 +1,19 @@
+#pragma once
+// src/app/inspector_ui.hpp
+// ImGui panels for the world inspector (body list, contacts, timings)
+
+#include "debug/inspector.hpp"
+
+#include <cstdint>
+
+struct InspectorUi {
+    bool show_bodies = false;
+    bool show_contacts = false;
+    bool show_timings = false;
+    int selected_body = -1;
+    sim::TimingHistory<> history;
+};
+
+/// Draw the inspector menu and open panels, then tell the capture which
+/// panels to fill on the next step
+void draw_inspector(InspectorUi& ui, sim::InspectorCapture& capture);
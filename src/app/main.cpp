@@ -1,7 +1,31 @@
+#include "debug_overlay.hpp"
+#include "demo_world.hpp"
+#include "ensemble_mode.hpp"
+#include "headless.hpp"
+#include "inspector_ui.hpp"
+
 #include <GLFW/glfw3.h>
+#include <imgui.h>
+#include <imgui_impl_glfw.h>
+#include <imgui_impl_opengl3.h>
 #include <cstdio>
+#include <cstring>
+
+int main(int argc, char** argv) {
+    // Offscreen and batch modes never touch GLFW, so they run without a display
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            HeadlessOptions opts;
+            if (!parse_headless_options(argc, argv, opts)) return 2;
+            return run_headless(opts);
+        }
+        if (std::strcmp(argv[i], "--ensemble") == 0) {
+            EnsembleOptions opts;
+            if (!parse_ensemble_options(argc, argv, opts)) return 2;
+            return run_ensemble(opts);
+        }
+    }
 
-int main() {
     if (!glfwInit()) {
         std::fprintf(stderr, "Failed to init GLFW\n");
         return -1;
@@ -25,12 +49,43 @@ int main() {
     glfwMakeContextCurrent(window);
     glfwSwapInterval(1); 
 
-    while (!glfwWindowShouldClose(window)) {
-        glfwPollEvents();
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGui_ImplGlfw_InitForOpenGL(window, true);
+    ImGui_ImplOpenGL3_Init("#version 330");
+
+    sim::InspectorCapture capture;
+    InspectorUi inspector;
+    DebugOverlay overlay;
+    {
+        SimThread sim_thread(capture);
 
-        glfwSwapBuffers(window);
+        while (!glfwWindowShouldClose(window)) {
+            glfwPollEvents();
+
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplGlfw_NewFrame();
+            ImGui::NewFrame();
+            draw_inspector(inspector, capture);
+            draw_debug_overlay(overlay, sim_thread);
+            ImGui::Render();
+
+            int width = 0;
+            int height = 0;
+            glfwGetFramebufferSize(window, &width, &height);
+            glViewport(0, 0, width, height);
+            glClearColor(0.07f, 0.07f, 0.09f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+            glfwSwapBuffers(window);
+        }
     }
 
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui_ImplGlfw_Shutdown();
+    ImGui::DestroyContext();
+
     glfwDestroyWindow(window);
     glfwTerminate();
     return 0;
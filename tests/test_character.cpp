@@ -0,0 +1,283 @@
+#include "../include/character/character_controller.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+struct Level {
+  Broadphase broadphase{1.0};
+  std::vector<Collider> colliders;
+
+  int add(const ConvexProxy& shape, const Vec2& p) {
+    colliders.push_back(Collider{shape, Transform2{p, Rot2{}}});
+    const auto index = static_cast<std::uint32_t>(colliders.size() - 1);
+    attach_collider(colliders, index, broadphase);
+    return static_cast<int>(index);
+  }
+
+  CollisionScene scene() const { return CollisionScene{broadphase, colliders}; }
+};
+
+// Ground slab with its top face at y = 0
+Level flat_level() {
+  Level level;
+  level.add(make_proxy(make_box(20.0, 0.5)), Vec2{0.0, -0.5});
+  return level;
+}
+
+// Capsule bottom sits at position.y - 0.8, plus the 0.01 skin
+constexpr double k_rest_height = 0.81;
+
+} // namespace
+
+void test_broadphase() {
+  std::cout << "Testing broadphase pairs and queries...\n";
+
+  Broadphase bp(1.0, 0.1);
+  const ProxyId a = bp.create_proxy(AABB{Vec2{0.0, 0.0}, Vec2{1.0, 1.0}}, 0);
+  const ProxyId b = bp.create_proxy(AABB{Vec2{0.5, 0.5}, Vec2{1.5, 1.5}}, 1);
+  const ProxyId c = bp.create_proxy(AABB{Vec2{5.0, 5.0}, Vec2{6.0, 6.0}}, 2);
+
+  bp.update_pairs();
+  assert(bp.pairs().size() == 1);
+  assert(bp.changes().begun.size() == 1);
+  assert((bp.changes().begun[0] == BroadphasePair{a, b}));
+
+  // Small motion stays inside the fat box: nothing to report
+  assert(!bp.move_proxy(b, AABB{Vec2{0.55, 0.5}, Vec2{1.55, 1.5}}));
+  bp.update_pairs();
+  assert(bp.changes().begun.empty() && bp.changes().ended.empty());
+
+  // Large motion ends the pair and begins a new one
+  assert(bp.move_proxy(b, AABB{Vec2{5.5, 5.5}, Vec2{6.5, 6.5}}));
+  bp.update_pairs();
+  assert(bp.changes().ended.size() == 1);
+  assert(bp.changes().begun.size() == 1);
+  assert((bp.changes().begun[0] == BroadphasePair{b, c}));
+
+  // A proxy spanning many cells is reported once
+  const ProxyId big = bp.create_proxy(AABB{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}}, 3);
+  int hits = 0;
+  bp.query(AABB{Vec2{-3.0, -3.0}, Vec2{3.0, 3.0}}, [&](ProxyId id) {
+    if (id == big) ++hits;
+  });
+  assert(hits == 1);
+
+  // Early out
+  int visited = 0;
+  bp.query(AABB{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}}, [&](ProxyId) {
+    ++visited;
+    return false;
+  });
+  assert(visited == 1);
+
+  // Region stamps only change where proxies come and go
+  const AABB far_region{Vec2{-8.0, -8.0}, Vec2{-7.0, -7.0}};
+  const AABB near_a{Vec2{0.2, 0.2}, Vec2{0.4, 0.4}};
+  const std::uint64_t far_stamp = bp.region_stamp(far_region);
+  const std::uint64_t a_stamp = bp.region_stamp(near_a);
+  bp.destroy_proxy(a);
+  assert(bp.region_stamp(far_region) == far_stamp);
+  assert(bp.region_stamp(near_a) > a_stamp);
+
+  bp.update_pairs();
+  assert(bp.proxy_count() == 3);
+
+  std::cout << "  ✓ Broadphase tests passed\n";
+}
+
+void test_shape_cast() {
+  std::cout << "Testing shape cast...\n";
+
+  const ConvexProxy box = make_proxy(make_box(1.0, 1.0));
+  const ConvexProxy ball = make_circle(Vec2{}, 0.5);
+
+  const CastOutput hit = shape_cast(box, Transform2{}, ball, Transform2{Vec2{3.0, 0.0}, Rot2{}},
+                                    Vec2{-4.0, 0.0});
+  assert(hit.hit);
+  assert(std::abs(hit.fraction - 0.375) < 1e-6);
+  assert(std::abs(hit.normal.x - 1.0) < 1e-9);
+
+  // Target separation stops the cast short by that gap
+  const CastOutput skin = shape_cast(box, Transform2{}, ball, Transform2{Vec2{3.0, 0.0}, Rot2{}},
+                                     Vec2{-4.0, 0.0}, 0.1);
+  assert(std::abs(skin.fraction - 0.35) < 1e-6);
+
+  // Sliding along a touching face is not a hit
+  const CastOutput slide = shape_cast(box, Transform2{}, ball, Transform2{Vec2{0.0, 1.5}, Rot2{}},
+                                      Vec2{5.0, 0.0});
+  assert(!slide.hit);
+
+  const CastOutput miss = shape_cast(box, Transform2{}, ball, Transform2{Vec2{3.0, 3.0}, Rot2{}},
+                                     Vec2{0.0, 5.0});
+  assert(!miss.hit);
+
+  std::cout << "  ✓ Shape cast tests passed\n";
+}
+
+void test_controller_land_and_slide() {
+  std::cout << "Testing character landing and wall slide...\n";
+
+  Level level = flat_level();
+  level.add(make_proxy(make_box(0.5, 5.0)), Vec2{2.0, 5.0});  // wall face at x = 1.5
+
+  CharacterController cc({}, Vec2{0.0, 3.0});
+  const MoveResult fall = cc.move(level.scene(), Vec2{0.0, -5.0});
+  assert(std::abs(cc.position().y - k_rest_height) < 1e-6);
+  assert(std::abs(fall.displacement.y + (3.0 - k_rest_height)) < 1e-6);
+  assert(cc.ground(level.scene()).grounded);
+
+  // Walk into the wall while falling: x stops, y keeps going
+  cc.teleport(Vec2{0.0, 3.0});
+  const MoveResult slide = cc.move(level.scene(), Vec2{5.0, -1.0});
+  assert(slide.hit_wall);
+  assert(std::abs(cc.position().x - (1.5 - 0.3 - 0.01)) < 1e-6);
+  assert(std::abs(cc.position().y - 2.0) < 1e-6);
+  assert(!cc.ground(level.scene()).grounded);
+
+  std::cout << "  ✓ Landing and wall slide tests passed\n";
+}
+
+void test_controller_step_and_slope() {
+  std::cout << "Testing character step-up and slope limit...\n";
+
+  {
+    Level level = flat_level();
+    level.add(make_proxy(make_box(1.0, 0.1)), Vec2{2.0, 0.1});  // 0.2 high step from x = 1
+
+    CharacterController cc({}, Vec2{0.0, k_rest_height});
+    assert(cc.ground(level.scene()).grounded);
+    const MoveResult r = cc.move(level.scene(), Vec2{2.0, 0.0});
+    assert(r.stepped);
+    assert(std::abs(cc.position().y - (0.2 + k_rest_height)) < 1e-3);
+    assert(cc.position().x > 1.5);
+    assert(cc.ground(level.scene()).grounded);
+  }
+
+  {
+    // Too tall to step over
+    Level level = flat_level();
+    level.add(make_proxy(make_box(1.0, 0.5)), Vec2{2.0, 0.5});
+
+    CharacterController cc({}, Vec2{0.0, k_rest_height});
+    (void)cc.ground(level.scene());
+    const MoveResult r = cc.move(level.scene(), Vec2{2.0, 0.0});
+    assert(!r.stepped && r.hit_wall);
+    assert(std::abs(cc.position().y - k_rest_height) < 1e-6);
+  }
+
+  {
+    // 60 degree ramp starting at x = 1: steeper than max_slope
+    Level level = flat_level();
+    const Vec2 ramp[] = {Vec2{1.0, 0.0}, Vec2{3.0, 0.0}, Vec2{3.0, 2.0 * std::sqrt(3.0)}};
+    level.add(make_proxy(make_polygon(ramp)), Vec2{});
+
+    CharacterController cc({}, Vec2{0.0, k_rest_height});
+    (void)cc.ground(level.scene());
+    for (int i = 0; i < 10; ++i) (void)cc.move(level.scene(), Vec2{0.3, -0.05});
+    assert(cc.position().y < k_rest_height + 0.01);
+  }
+
+  {
+    // 30 degree ramp: walkable
+    Level level = flat_level();
+    const Vec2 ramp[] = {Vec2{1.0, 0.0}, Vec2{6.0, 0.0}, Vec2{6.0, 5.0 / std::sqrt(3.0)}};
+    level.add(make_proxy(make_polygon(ramp)), Vec2{});
+
+    CharacterController cc({}, Vec2{0.0, k_rest_height});
+    (void)cc.ground(level.scene());
+    for (int i = 0; i < 10; ++i) (void)cc.move(level.scene(), Vec2{0.3, -0.05});
+    assert(cc.position().y > k_rest_height + 0.5);
+    assert(cc.ground(level.scene()).grounded);
+  }
+
+  std::cout << "  ✓ Step-up and slope tests passed\n";
+}
+
+void test_ground_cache() {
+  std::cout << "Testing ground query cache...\n";
+
+  Level level = flat_level();
+  CharacterController cc({}, Vec2{0.0, 2.0});
+  (void)cc.move(level.scene(), Vec2{0.0, -5.0});
+
+  const ControllerStats before = cc.stats();
+  for (int i = 0; i < 100; ++i) assert(cc.ground(level.scene()).grounded);
+  assert(cc.stats().ground_recomputes == before.ground_recomputes);
+  assert(cc.stats().broadphase_queries == before.broadphase_queries);
+  assert(cc.stats().ground_cache_hits == before.ground_cache_hits + 100);
+
+  // Ground drops slightly (inside its fat box): revision invalidates
+  level.colliders[0].set_transform(Transform2{Vec2{0.0, -0.52}, Rot2{}}, level.broadphase);
+  const GroundInfo& g = cc.ground(level.scene());
+  assert(cc.stats().ground_recomputes == before.ground_recomputes + 1);
+  assert(g.grounded);
+  assert(std::abs(g.distance - 0.02) < 1e-6);
+
+  // A new collider under the character: region stamp invalidates
+  (void)cc.ground(level.scene());
+  const std::uint64_t recomputes = cc.stats().ground_recomputes;
+  level.add(make_proxy(make_box(0.5, 0.01)), Vec2{0.0, -0.01});
+  (void)cc.ground(level.scene());
+  assert(cc.stats().ground_recomputes == recomputes + 1);
+  assert(cc.ground(level.scene()).collider == 1);
+
+  // A collider far away leaves the cache alone
+  level.add(make_proxy(make_box(0.5, 0.5)), Vec2{15.0, 3.0});
+  (void)cc.ground(level.scene());
+  assert(cc.stats().ground_recomputes == recomputes + 1);
+
+  std::cout << "  ✓ Ground cache tests passed\n";
+}
+
+void test_depenetration() {
+  std::cout << "Testing depenetration...\n";
+
+  // Capsule cores starting inside a 2x2 box from each side: pushed out
+  // along the shallow axis to the skin distance, not sideways or nowhere
+  Level level;
+  level.add(make_proxy(make_box(1.0, 1.0)), Vec2{});
+  const double side = 1.0 + 0.3 + 0.01;   // box face + radius + skin
+  const double top = 1.0 + 0.8 + 0.01;    // box face + half height + skin
+  const struct {
+    Vec2 start;
+    Vec2 expected;
+    Vec2 normal;
+  } cases[] = {
+    {Vec2{0.9, 0.2}, Vec2{side, 0.2}, Vec2{1.0, 0.0}},
+    {Vec2{-0.9, 0.2}, Vec2{-side, 0.2}, Vec2{-1.0, 0.0}},
+    {Vec2{0.2, 1.4}, Vec2{0.2, top}, Vec2{0.0, 1.0}},
+    {Vec2{0.2, -1.4}, Vec2{0.2, -top}, Vec2{0.0, -1.0}},
+  };
+  for (const auto& c : cases) {
+    CharacterController cc({}, c.start);
+    (void)cc.move(level.scene(), Vec2{});
+    assert(cc.position().distance_to(c.expected) < 1e-6);
+
+    // The overlapping cast reports the same push-out direction
+    const CastOutput cast = shape_cast(level.colliders[0].shape, Transform2{}, cc.config().shape,
+                                       Transform2{c.start, Rot2{}}, Vec2{0.0, -1.0});
+    assert(cast.hit && cast.initially_overlapping);
+    assert(cast.normal.distance_to(c.normal) < 1e-9);
+  }
+
+  std::cout << "  ✓ Depenetration tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Character Controller Tests ===\n\n";
+
+  test_broadphase();
+  test_shape_cast();
+  test_controller_land_and_slide();
+  test_controller_step_and_slope();
+  test_ground_cache();
+  test_depenetration();
+
+  std::cout << "\n✓ All character controller tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,149 @@
+#include "../include/debug/debug_draw.hpp"
+#include "../include/dynamics/joints.hpp"
+#include "../include/render/raster.hpp"
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace sim;
+
+void test_debug_draw_recording() {
+  std::cout << "Testing debug draw recording...\n";
+
+  DebugDrawBuffer<true> buf;
+  buf.aabb(AABB{Vec2{-1.0, -1.0}, Vec2{1.0, 2.0}});
+  assert(buf.batch().lines.size() == 4);
+  assert(buf.batch().lines[0].color == debug_colors::kAabb);
+
+  buf.polygon(make_box(0.5, 0.5), Transform2{Vec2{3.0, 0.0}, Rot2::from_angle(0.0)});
+  assert(buf.batch().lines.size() == 8);
+  assert(buf.batch().lines[4].x0 >= 2.5f && buf.batch().lines[4].x0 <= 3.5f);
+
+  Manifold m;
+  m.normal = Vec2{0.0, 1.0};
+  m.count = 2;
+  m.points[0].point = Vec2{0.0, 0.0};
+  m.points[1].point = Vec2{1.0, 0.0};
+  buf.manifold(m, 0.5);
+  assert(buf.batch().points.size() == 2);
+  assert(buf.batch().lines.size() == 10);
+  const DebugLine& normal = buf.batch().lines[9];
+  assert(normal.x0 == 1.0f && normal.y1 == 0.5f && normal.color == debug_colors::kNormal);
+
+  std::vector<RigidBody> bodies(2);
+  bodies[0].position = Vec2{0.0, 0.0};
+  bodies[1].position = Vec2{2.0, 0.0};
+  RevoluteJointDef def;
+  def.body_a = 0;
+  def.body_b = 1;
+  def.local_anchor_a = Vec2{1.0, 0.0};
+  def.local_anchor_b = Vec2{-1.0, 0.0};
+  buf.joint(def, bodies);
+  assert(buf.batch().lines.size() == 13);
+
+  buf.circle(Vec2{0.0, 0.0}, 1.5, debug_colors::kShape);
+  assert(buf.batch().circles.size() == 1 && buf.batch().circles[0].radius == 1.5f);
+
+  buf.clear();
+  assert(buf.batch().size() == 0);
+
+  std::cout << "  ✓ Debug draw recording tests passed\n";
+}
+
+void test_debug_draw_merge() {
+  std::cout << "Testing debug draw per-thread merge...\n";
+
+  // Each worker records into its own slot without locking
+  constexpr std::size_t kThreads = 4;
+  BasicDebugDraw<true> draw(kThreads);
+  assert(draw.thread_count() == kThreads);
+  for (int frame = 0; frame < 2; ++frame) {
+    draw.begin_frame();
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+      workers.emplace_back([&draw, t] {
+        DebugDrawBuffer<true>& buf = draw.thread(t);
+        for (int i = 0; i < 100; ++i) {
+          buf.line(Vec2{0.0, 0.0}, Vec2{1.0, static_cast<double>(t)}, debug_colors::kShape);
+          buf.point(Vec2{static_cast<double>(t), 0.0}, 3.0f, debug_colors::kContact);
+        }
+        if (t == 0) buf.circle(Vec2{}, 1.0, debug_colors::kJoint);
+      });
+    }
+    for (std::thread& w : workers) w.join();
+
+    // begin_frame() dropped the previous frame, so counts do not grow
+    const DebugDrawBatch& merged = draw.merge();
+    assert(merged.lines.size() == kThreads * 100);
+    assert(merged.points.size() == kThreads * 100);
+    assert(merged.circles.size() == 1);
+    // Thread order is preserved: slot 0's primitives come first
+    assert(merged.lines.front().y1 == 0.0f && merged.lines.back().y1 == 3.0f);
+  }
+
+  std::cout << "  ✓ Debug draw merge tests passed\n";
+}
+
+void test_debug_draw_disabled() {
+  std::cout << "Testing disabled debug draw...\n";
+
+  // The disabled buffer carries no state and records nothing
+  static_assert(std::is_empty_v<DebugDrawBuffer<false>>);
+  static_assert(!BasicDebugDraw<false>::enabled);
+
+  BasicDebugDraw<false> draw(8);
+  assert(draw.thread_count() == 0);
+  draw.begin_frame();
+  DebugDrawBuffer<false>& buf = draw.thread(3);
+  buf.line(Vec2{}, Vec2{1.0, 1.0}, debug_colors::kShape);
+  buf.aabb(AABB{Vec2{}, Vec2{1.0, 1.0}});
+  buf.polygon(make_box(1.0, 1.0), Transform2{});
+  buf.manifold(Manifold{});
+  buf.grid(AABB{Vec2{}, Vec2{4.0, 4.0}}, 1.0);
+  assert(draw.merge().size() == 0);
+
+  std::cout << "  ✓ Disabled debug draw tests passed\n";
+}
+
+void test_debug_draw_raster() {
+  std::cout << "Testing debug draw rasterization...\n";
+
+  DebugDrawBuffer<true> buf;
+  buf.line(Vec2{-5.0, 0.0}, Vec2{5.0, 0.0}, debug_rgba(255, 0, 0));
+  buf.circle(Vec2{0.0, 0.0}, 4.0, debug_rgba(0, 255, 0));
+  buf.point(Vec2{-2.0, 2.0}, 6.0f, debug_rgba(0, 0, 255));
+
+  RasterView view;
+  view.world = AABB{Vec2{-5.0, -5.0}, Vec2{5.0, 5.0}};
+  view.width = 100;
+  view.height = 100;
+  Rasterizer raster(view);
+  raster.clear(Color{0, 0, 0, 255});
+  raster.draw_debug(buf.batch());
+
+  const Image& img = raster.image();
+  const Color on_line = img.at(20, 50);          // world (-3, 0)
+  assert(on_line.r == 255 && on_line.g == 0);
+  const Color on_circle = img.at(50, 10);        // world (0, 4)
+  assert(on_circle.g == 255);
+  const Color on_point = img.at(30, 30);         // world (-2, 2)
+  assert(on_point.b == 255);
+  const Color empty = img.at(75, 75);
+  assert(empty.r == 0 && empty.g == 0 && empty.b == 0);
+
+  std::cout << "  ✓ Debug draw rasterization tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Debug Draw Tests ===\n\n";
+
+  test_debug_draw_recording();
+  test_debug_draw_merge();
+  test_debug_draw_disabled();
+  test_debug_draw_raster();
+
+  std::cout << "\n✓ All debug draw tests passed!\n\n";
+  return 0;
+}
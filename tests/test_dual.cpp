@@ -0,0 +1,155 @@
+#include "../include/math/dual.hpp"
+#include "../include/math/vec2.hpp"
+#include "../include/particles/adjoint.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+
+using namespace sim;
+
+namespace {
+
+bool near(double a, double b, double tol = 1e-9) {
+  return std::abs(a - b) <= tol * (1.0 + std::abs(b));
+}
+
+void test_dual_arithmetic() {
+  std::cout << "Testing dual arithmetic...\n";
+
+  using D = Dual<2>;
+  const D x = D::variable(1.5, 0);
+  const D y = D::variable(-0.5, 1);
+
+  // f = x^2 y + 3x - y / x
+  const D f = x * x * y + 3.0 * x - y / x;
+  assert(near(f.v, 1.5 * 1.5 * -0.5 + 4.5 + 0.5 / 1.5));
+  assert(near(derivative(f, 0), 2.0 * 1.5 * -0.5 + 3.0 - 0.5 / (1.5 * 1.5)));
+  assert(near(derivative(f, 1), 1.5 * 1.5 - 1.0 / 1.5));
+
+  // Elementary functions follow the chain rule
+  const D g = sin(x) * exp(y) + log(x) + sqrt(x) + pow(x, 3.0) - cos(y);
+  assert(near(derivative(g, 0),
+              std::cos(1.5) * std::exp(-0.5) + 1.0 / 1.5 + 0.5 / std::sqrt(1.5) + 3.0 * 1.5 * 1.5));
+  assert(near(derivative(g, 1), std::sin(1.5) * std::exp(-0.5) + std::sin(-0.5)));
+  assert(near(derivative(abs(y), 1), -1.0));
+
+  // Comparisons and implicit conversion look at the value only
+  const D c = 2.0;
+  assert(c.d[0] == 0.0 && c.d[1] == 0.0);
+  assert(x < 2.0 && y < x && x == 1.5);
+  assert(value_of(f) == f.v && value_of(2.0) == 2.0);
+
+  std::cout << "  ✓ Dual arithmetic tests passed\n";
+}
+
+void test_vec2_of_duals() {
+  std::cout << "Testing BasicVec2<Dual>...\n";
+
+  using D = Dual<2>;
+  using DVec2 = BasicVec2<D>;
+  const DVec2 p{D::variable(3.0, 0), D::variable(4.0, 1)};
+
+  // |p| = 5, d|p|/dp = p / |p|
+  const D len = p.length();
+  assert(near(len.v, 5.0));
+  assert(near(derivative(len, 0), 0.6) && near(derivative(len, 1), 0.8));
+
+  // Mixed scaling: plain scalars and duals on either side
+  const DVec2 q = 2.0 * p + p * len - p / 2;
+  assert(near(q.x.v, 6.0 + 15.0 - 1.5));
+  // dq.x/dx = 2 + len + x * dlen/dx - 0.5
+  assert(near(derivative(q.x, 0), 2.0 + 5.0 + 3.0 * 0.6 - 0.5));
+
+  const D c = p.cross(DVec2{1.0, 2.0});
+  assert(near(derivative(c, 0), 2.0) && near(derivative(c, 1), -1.0));
+  const DVec2 n = p.normalized();
+  assert(near(n.x.v, 0.6));
+  // d(x / |p|)/dy = -x y / |p|^3
+  assert(near(derivative(n.x, 1), -12.0 / 125.0));
+
+  // The engine's Vec2 is unchanged
+  static_assert(std::is_same_v<Vec2, BasicVec2<double>>);
+  static_assert(std::is_same_v<decltype(Vec2{}.length()), double>);
+  assert((Vec2{3.0, 4.0} * 2).length() == 10.0);
+
+  std::cout << "  ✓ BasicVec2<Dual> tests passed\n";
+}
+
+void test_forward_matches_adjoint() {
+  std::cout << "Testing forward-mode vs adjoint gradients...\n";
+
+  constexpr double dt = 1.0 / 120.0;
+  constexpr std::size_t steps = 40;
+
+  DiffModel model;
+  model.inv_mass = {0.0, 1.0, 0.5};
+  model.springs = {Spring{0, 1}, Spring{1, 2}};
+
+  DiffParams p;
+  p.gravity = Vec2{0.2, -9.81};
+  p.drag = 0.3;
+  p.stiffness = {70.0, 50.0};
+  p.rest_length = {0.5, 0.4};
+
+  DiffState s0(3);
+  s0.x = {0.0, 0.4, 0.8};
+  s0.y = {0.0, -0.2, -0.5};
+  s0.vx = {0.0, 0.3, -0.2};
+  s0.vy = {0.0, 0.0, 0.4};
+
+  // Loss: x + y of the last particle at the end. Reverse mode gives every
+  // gradient in one backward pass...
+  AdjointRollout rollout(model, dt, steps, 4);
+  rollout.forward(s0, p);
+  DiffState seed(3), grad_state;
+  seed.x[2] = 1.0;
+  seed.y[2] = 1.0;
+  DiffParams grad_params;
+  rollout.backward(seed, grad_state, grad_params);
+
+  // ...forward mode seeds the chosen inputs: drag, stiffness[1], x0[2], vy0[1]
+  using D = Dual<4>;
+  BasicDiffParams<D> dp;
+  dp.gravity = BasicVec2<D>{p.gravity.x, p.gravity.y};
+  dp.drag = D::variable(p.drag, 0);
+  dp.stiffness = {p.stiffness[0], D::variable(p.stiffness[1], 1)};
+  dp.rest_length = {p.rest_length[0], p.rest_length[1]};
+  BasicDiffState<D> a(3), b(3);
+  for (std::size_t i = 0; i < 3; ++i) {
+    a.x[i] = s0.x[i];
+    a.y[i] = s0.y[i];
+    a.vx[i] = s0.vx[i];
+    a.vy[i] = s0.vy[i];
+  }
+  a.x[2] = D::variable(s0.x[2], 2);
+  a.vy[1] = D::variable(s0.vy[1], 3);
+  for (std::size_t k = 0; k < steps; ++k) {
+    diff_step(model, dp, a, b, dt);
+    std::swap(a, b);
+  }
+  const D loss = a.x[2] + a.y[2];
+
+  // Same trajectory in value, same gradients as the adjoint
+  const DiffState& fin = rollout.final_state();
+  assert(near(a.x[2].v, fin.x[2], 1e-12) && near(a.y[2].v, fin.y[2], 1e-12));
+  assert(near(derivative(loss, 0), grad_params.drag, 1e-8));
+  assert(near(derivative(loss, 1), grad_params.stiffness[1], 1e-8));
+  assert(near(derivative(loss, 2), grad_state.x[2], 1e-8));
+  assert(near(derivative(loss, 3), grad_state.vy[1], 1e-8));
+
+  std::cout << "  ✓ Forward-mode vs adjoint tests passed\n";
+}
+
+} // namespace
+
+int main() {
+  std::cout << "=== Running Dual Number Tests ===\n\n";
+
+  test_dual_arithmetic();
+  test_vec2_of_duals();
+  test_forward_matches_adjoint();
+
+  std::cout << "\n✓ All dual number tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,164 @@
+// The release configuration: no FP validation, so NaN worlds keep stepping
+#define SIM_FP_VALIDATION 0
+#include "../include/particles/ensemble.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace sim;
+
+namespace {
+
+ParticleWorldParams small_world() {
+  ParticleWorldParams p;
+  p.particles = 200;
+  p.radius = 0.02;
+  return p;
+}
+
+bool same(const WorldSummary& a, const WorldSummary& b) {
+  return a.seed == b.seed && a.steps == b.steps && a.kinetic_energy == b.kinetic_energy &&
+         a.center_of_mass == b.center_of_mass && a.max_speed == b.max_speed &&
+         a.contacts == b.contacts;
+}
+
+} // namespace
+
+void test_particle_world() {
+  std::cout << "Testing ensemble particle world...\n";
+
+  const double dt = 1.0 / 240.0;
+  ParticleWorld world(small_world());
+  assert(world.particles().size() == 200);
+  const double y0 = summarize_world(world).center_of_mass.y;
+  assert(y0 > 0.5);                        // seeded in the upper half
+
+  for (int s = 0; s < 960; ++s) world.step(dt);
+  const WorldSummary settled = summarize_world(world);
+  assert(settled.steps == 960);
+  assert(std::abs(world.time() - 4.0) < 1e-9);
+  assert(settled.center_of_mass.y < y0);   // fell under gravity
+  assert(settled.contacts > 0);            // and piled up
+  // Everything stays inside the walls
+  const ParticleStore& ps = world.particles();
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    assert(ps.x[i] >= 0.0 && ps.x[i] <= 1.0 && ps.y[i] >= 0.0 && ps.y[i] <= 1.0);
+  }
+
+  // Same seed, same trajectory; a reset restarts it exactly
+  ParticleWorld again(small_world());
+  for (int s = 0; s < 960; ++s) again.step(dt);
+  assert(same(summarize_world(again), settled));
+  again.reset(small_world().seed);
+  for (int s = 0; s < 960; ++s) again.step(dt);
+  assert(same(summarize_world(again), settled));
+
+  std::cout << "  ✓ Ensemble particle world tests passed\n";
+}
+
+void test_ensemble_run() {
+  std::cout << "Testing ensemble run...\n";
+
+  const double dt = 1.0 / 240.0;
+  const std::vector<ParticleWorldParams> params = seed_sweep(small_world(), 12);
+  assert(params[0].seed == 1 && params[11].seed == 12);
+
+  // Reference: every world on the calling thread
+  Ensemble<ParticleWorld> serial;
+  for (const ParticleWorldParams& p : params) serial.emplace(p);
+  serial.run(120, dt);
+  const std::vector<WorldSummary> expected = serial.collect(summarize_world);
+  assert(expected.size() == 12);
+  assert(serial.stats().worlds == 12 && serial.stats().world_steps == 12 * 120);
+
+  // Results do not depend on the worker count or scheduling
+  TaskPool pool(3);
+  Ensemble<ParticleWorld> parallel(&pool);
+  for (const ParticleWorldParams& p : params) parallel.emplace(p);
+  parallel.run(60, dt);
+  parallel.run(60, dt);
+  const std::vector<WorldSummary> got = parallel.collect(summarize_world);
+  for (std::size_t w = 0; w < got.size(); ++w) {
+    assert(same(got[w], expected[w]));
+    assert(got[w].seed == params[w].seed);   // world order kept
+  }
+  // Different seeds give different worlds
+  assert(!same(got[0], got[1]));
+
+  // A sweep builds, runs and drops each world inside its job
+  const std::vector<WorldSummary> swept = run_sweep<ParticleWorld>(
+    &pool, std::span<const ParticleWorldParams>(params), 120, dt, summarize_world);
+  for (std::size_t w = 0; w < swept.size(); ++w) assert(same(swept[w], expected[w]));
+
+  std::cout << "  ✓ Ensemble run tests passed\n";
+}
+
+void test_ensemble_custom_world() {
+  std::cout << "Testing ensemble with a custom world type...\n";
+
+  // Any type with step(double) can be an ensemble member
+  struct Decay {
+    double value{1.0};
+    double rate{0.0};
+    explicit Decay(double r) : rate(r) {}
+    void step(double dt) { value -= rate * value * dt; }
+  };
+  static_assert(EnsembleWorld<Decay>);
+
+  TaskPool pool(2);
+  const std::vector<double> rates{0.0, 0.5, 1.0, 2.0};
+  const std::vector<double> finals = run_sweep<Decay>(
+    &pool, std::span<const double>(rates), 1000, 1e-3, [](const Decay& d) { return d.value; });
+  assert(finals[0] == 1.0);
+  for (std::size_t i = 1; i < rates.size(); ++i) {
+    assert(finals[i] < finals[i - 1]);
+    assert(std::abs(finals[i] - std::exp(-rates[i])) < 1e-2);
+  }
+
+  std::cout << "  ✓ Ensemble custom world tests passed\n";
+}
+
+void test_non_finite_world() {
+  std::cout << "Testing a non-finite world in an ensemble...\n";
+
+  // Without validation nothing halts: the NaN world keeps stepping (its
+  // particles drop out of the grid), is flagged in its summary, and the
+  // other worlds are unaffected
+  static_assert(!kFpValidation);
+  const double dt = 1.0 / 240.0;
+  TaskPool pool(2);
+  Ensemble<ParticleWorld> clean(&pool), poisoned(&pool);
+  for (const ParticleWorldParams& p : seed_sweep(small_world(), 4)) {
+    clean.emplace(p);
+    poisoned.emplace(p);
+  }
+  poisoned.world(1).particles().vx[17] = std::nan("");
+  clean.run(200, dt);
+  poisoned.run(200, dt);
+
+  const std::vector<WorldSummary> a = clean.collect(summarize_world);
+  const std::vector<WorldSummary> b = poisoned.collect(summarize_world);
+  for (std::size_t w = 0; w < a.size(); ++w) {
+    assert(a[w].finite && !a[w].halted && !b[w].halted);
+    assert(b[w].steps == 200);
+    if (w == 1) {
+      assert(!b[w].finite);
+    } else {
+      assert(b[w].finite && same(a[w], b[w]));
+    }
+  }
+
+  std::cout << "  ✓ Non-finite world tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Ensemble Tests ===\n\n";
+
+  test_particle_world();
+  test_ensemble_run();
+  test_ensemble_custom_world();
+  test_non_finite_world();
+
+  std::cout << "\n✓ All ensemble tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include "../include/collision/sensor.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+constexpr std::uint32_t k_world = 0x0001;
+constexpr std::uint32_t k_debris = 0x0002;
+constexpr std::uint32_t k_player = 0x0004;
+
+} // namespace
+
+void test_filter_rules() {
+  std::cout << "Testing filter rules...\n";
+
+  const CollisionFilter world{k_world, 0xFFFF'FFFF, 0};
+  const CollisionFilter debris{k_debris, ~k_debris, 0};
+  const CollisionFilter player{k_player, k_world, 0};
+
+  assert(should_collide(world, debris));
+  assert(!should_collide(debris, debris));
+  assert(should_collide(world, player));
+  assert(!should_collide(player, debris));  // one-sided masks are enough to reject
+
+  // Shared groups override masks
+  const CollisionFilter limb_a{k_player, 0xFFFF'FFFF, -3};
+  const CollisionFilter limb_b{k_player, 0xFFFF'FFFF, -3};
+  assert(!should_collide(limb_a, limb_b));
+  const CollisionFilter glued_a{k_debris, ~k_debris, 5};
+  const CollisionFilter glued_b{k_debris, ~k_debris, 5};
+  assert(should_collide(glued_a, glued_b));
+  // Different groups fall back to masks
+  assert(should_collide(limb_a, CollisionFilter{k_player, 0xFFFF'FFFF, -4}));
+
+  std::cout << "  ✓ Filter rule tests passed\n";
+}
+
+void test_filter_broadphase() {
+  std::cout << "Testing filtering in broadphase pair emission...\n";
+
+  Broadphase bp(1.0, 0.1);
+  const ProxyId ground = bp.create_proxy(AABB{Vec2{-10.0, -1.0}, Vec2{10.0, 0.0}}, 0,
+                                         CollisionFilter{k_world, 0xFFFF'FFFF, 0});
+  // A heap of overlapping debris resting on the ground
+  std::vector<ProxyId> debris;
+  for (int i = 0; i < 50; ++i) {
+    const double x = -2.0 + 0.08 * i;
+    debris.push_back(bp.create_proxy(AABB{Vec2{x, -0.1}, Vec2{x + 0.5, 0.4}}, 1 + i,
+                                     CollisionFilter{k_debris, ~k_debris, 0}));
+  }
+  bp.update_pairs();
+
+  // Only debris-vs-ground survives
+  assert(bp.pairs().size() == debris.size());
+  for (const BroadphasePair& p : bp.pairs()) assert(p.a == ground || p.b == ground);
+  assert(bp.filtered_count() > debris.size());
+
+  // Changing a filter re-evaluates that proxy's pairs
+  bp.set_filter(debris[0], CollisionFilter{k_debris, 0, 0});
+  bp.update_pairs();
+  assert(bp.changes().ended.size() == 1);
+  assert(bp.pairs().size() == debris.size() - 1);
+
+  bp.set_filter(debris[0], CollisionFilter{k_world, 0xFFFF'FFFF, 0});
+  bp.update_pairs();
+  assert(bp.changes().begun.size() > 1);  // ground plus the debris it now touches
+  for (const BroadphasePair& p : bp.changes().begun) assert(p.a == debris[0] || p.b == debris[0]);
+
+  std::cout << "  ✓ Broadphase filtering tests passed\n";
+}
+
+void test_filter_sensors() {
+  std::cout << "Testing filtered sensors...\n";
+
+  Broadphase bp(1.0, 0.1);
+  std::vector<Collider> colliders(3);
+  colliders[0].shape = make_proxy(make_box(1.0, 1.0));
+  colliders[0].is_sensor = true;
+  colliders[0].filter = CollisionFilter{k_world, k_player, 0};  // pickup zone: players only
+  colliders[1].shape = make_circle(Vec2{}, 0.2);
+  colliders[1].filter = CollisionFilter{k_player, 0xFFFF'FFFF, 0};
+  colliders[2].shape = make_circle(Vec2{}, 0.2);
+  colliders[2].filter = CollisionFilter{k_debris, ~k_debris, 0};
+  for (std::uint32_t i = 0; i < 3; ++i) attach_collider(colliders, i, bp);
+
+  SensorSystem sensors;
+  bp.update_pairs();
+  sensors.update(bp, colliders);
+  assert(sensors.events().begin.size() == 1);
+  assert(sensors.events().begin[0].visitor == 1);
+  assert(sensors.candidate_count() == 1);
+
+  std::cout << "  ✓ Filtered sensor tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Collision Filter Tests ===\n\n";
+
+  test_filter_rules();
+  test_filter_broadphase();
+  test_filter_sensors();
+
+  std::cout << "\n✓ All collision filter tests passed!\n\n";
+  return 0;
+}
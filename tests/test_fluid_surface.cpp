@@ -0,0 +1,130 @@
+#include "../include/render/fluid_surface.hpp"
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <utility>
+
+using namespace sim;
+
+namespace {
+
+/// Particles on a hex-ish lattice filling a disc
+ParticleStore disc(const Vec2& center, double radius, double spacing) {
+  ParticleStore ps;
+  for (double y = -radius; y <= radius; y += spacing) {
+    for (double x = -radius; x <= radius; x += spacing) {
+      if (x * x + y * y <= radius * radius) ps.add(center + Vec2{x, y}, Vec2{}, 1.0);
+    }
+  }
+  return ps;
+}
+
+FluidSurfaceConfig config() {
+  FluidSurfaceConfig cfg;
+  cfg.domain = AABB{Vec2{0.0, 0.0}, Vec2{8.0, 8.0}};
+  cfg.cell = 0.1;
+  cfg.radius = 0.3;
+  cfg.iso = 0.5;
+  cfg.tile_cells = 8;
+  return cfg;
+}
+
+} // namespace
+
+void test_task_pool() {
+  std::cout << "Testing task pool...\n";
+
+  TaskPool pool(3);
+  assert(pool.workers() == 3);
+  std::vector<int> hits(1000, 0);
+  for (int round = 0; round < 20; ++round) {
+    pool.parallel_for(hits.size(), [&](std::size_t i) { ++hits[i]; }, 7);
+  }
+  for (const int h : hits) assert(h == 20);
+
+  TaskPool inline_pool(0);
+  std::atomic<int> sum{0};
+  inline_pool.parallel_for(10, [&](std::size_t i) { sum += static_cast<int>(i); });
+  parallel_for(nullptr, 10, [&](std::size_t i) { sum += static_cast<int>(i); });
+  assert(sum == 90);
+
+  std::cout << "  ✓ Task pool tests passed\n";
+}
+
+void test_surface_extraction() {
+  std::cout << "Testing surface extraction...\n";
+
+  const Vec2 center{4.0, 4.0};
+  ParticleStore ps = disc(center, 1.5, 0.08);
+  FluidSurface surface(config());
+  assert(surface.update(ps) == surface.tile_count());
+
+  // Closed contour near the disc's edge: every endpoint is shared by
+  // exactly two segments, including across tile borders
+  std::map<std::pair<long long, long long>, int> ends;
+  auto key = [](const Vec2& p) {
+    return std::make_pair(std::llround(p.x * 1e7), std::llround(p.y * 1e7));
+  };
+  std::size_t segments = 0;
+  surface.for_each_segment([&](const SurfaceSegment& s) {
+    ++segments;
+    ++ends[key(s.a)];
+    ++ends[key(s.b)];
+    assert(std::abs(s.a.distance_to(center) - 1.6) < 0.2);
+  });
+  assert(segments == surface.stats().segments && segments > 50);
+  for (const auto& [p, count] : ends) assert(count == 2);
+
+  std::cout << "  ✓ Surface extraction tests passed\n";
+}
+
+void test_incremental_update() {
+  std::cout << "Testing incremental tile updates...\n";
+
+  ParticleStore ps = disc(Vec2{4.0, 4.0}, 1.5, 0.08);
+  TaskPool pool(3);
+  FluidSurface surface(config(), &pool);
+  surface.update(ps);
+
+  // Nothing moved: nothing rebuilt
+  assert(surface.update(ps) == 0);
+
+  // Sub-tolerance jitter is ignored
+  ps.x[0] += 0.005;
+  assert(surface.update(ps) == 0);
+
+  // One particle moves: only the tiles around it are rebuilt
+  ps.x[10] += 0.2;
+  const std::size_t rebuilt = surface.update(ps);
+  assert(rebuilt > 0 && rebuilt <= 4);
+  assert(surface.stats().particles_moved == 1);
+
+  // Same field as a full serial rebuild from the same splat positions
+  ps.x[0] -= 0.005;
+  FluidSurface fresh(config());
+  fresh.update(ps);
+  const int nodes = static_cast<int>(8.0 / 0.1);
+  for (int j = 0; j <= nodes; ++j) {
+    for (int i = 0; i <= nodes; ++i) assert(std::abs(surface.density(i, j) - fresh.density(i, j)) < 1e-12);
+  }
+  assert(surface.stats().segments == fresh.stats().segments);
+
+  // Removing a particle re-snapshots everything
+  ps.remove(0);
+  assert(surface.update(ps) == surface.tile_count());
+
+  std::cout << "  ✓ Incremental update tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Fluid Surface Tests ===\n\n";
+
+  test_task_pool();
+  test_surface_extraction();
+  test_incremental_update();
+
+  std::cout << "\n✓ All fluid surface tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,160 @@
+#include "../include/particles/force_fields.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+using namespace sim;
+
+void test_particle_grid() {
+  std::cout << "Testing particle grid...\n";
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> coord(-20.0, 20.0);
+  ParticleStore ps;
+  for (int i = 0; i < 2000; ++i) ps.add(Vec2{coord(rng), coord(rng)});
+
+  ParticleGrid grid(1.0);
+  grid.build(ps.x, ps.y);
+
+  // indices is a permutation sorted by cell
+  std::vector<std::uint32_t> sorted(grid.indices().begin(), grid.indices().end());
+  for (std::size_t k = 1; k < sorted.size(); ++k) {
+    assert(grid.cell_of(sorted[k - 1]) <= grid.cell_of(sorted[k]));
+  }
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t k = 0; k < sorted.size(); ++k) assert(sorted[k] == k);
+
+  // Spans cover every particle in the box
+  const AABB box{Vec2{-3.3, 2.1}, Vec2{4.7, 6.9}};
+  std::vector<bool> seen(ps.size(), false);
+  std::size_t visited = 0;
+  grid.for_each_span(box, [&](std::span<const std::uint32_t> ids) {
+    for (const std::uint32_t i : ids) seen[i] = true;
+    visited += ids.size();
+  });
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    if (box.contains(ps.position(i))) assert(seen[i]);
+  }
+  assert(visited < ps.size() / 10);
+
+  // Far-away boxes see nothing
+  int calls = 0;
+  grid.for_each_span(AABB{Vec2{100.0, 100.0}, Vec2{101.0, 101.0}}, [&](auto) { ++calls; });
+  assert(calls == 0);
+
+  // Non-finite particles are left out; NaN query boxes see nothing
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  ps.x[5] = nan;
+  ps.y[9] = -inf;
+  grid.build(ps.x, ps.y);
+  assert(grid.indices().size() == ps.size() - 2);
+  assert(grid.cell_of(5) == ParticleGrid::kNoCell && grid.cell_of(9) == ParticleGrid::kNoCell);
+  grid.for_each_span(AABB{Vec2{nan, nan}, Vec2{nan, nan}}, [&](auto) { ++calls; });
+  assert(calls == 0);
+  std::size_t all = 0;
+  grid.for_each_span(AABB{Vec2{-inf, -inf}, Vec2{inf, inf}}, [&](auto ids) { all += ids.size(); });
+  assert(all == ps.size() - 2);
+  std::fill(ps.x.begin(), ps.x.end(), nan);
+  grid.build(ps.x, ps.y);
+  assert(grid.indices().empty());
+
+  std::cout << "  ✓ Particle grid tests passed\n";
+}
+
+void test_field_kernels() {
+  std::cout << "Testing field kernels...\n";
+
+  ParticleStore ps;
+  ps.add(Vec2{0.5, 0.0}, Vec2{1.0, 0.0});
+  ps.add(Vec2{5.0, 0.0});
+
+  ForceFieldSet fields;
+  fields.uniforms.push_back(UniformField{Vec2{0.0, 1.0}, Vec2{3.0, 0.0}, 0.5});
+  fields.apply(ps, 0.0);
+  assert(std::abs(ps.fx[0] - 1.0) < 1e-12);   // 0.5 * (3 - 1)
+  assert(std::abs(ps.fy[0] - 1.0) < 1e-12);
+  assert(std::abs(ps.fx[1] - 1.5) < 1e-12);
+
+  // Attractor at the origin: pulls particle 0 towards -x, ignores particle 1
+  std::fill(ps.fx.begin(), ps.fx.end(), 0.0);
+  std::fill(ps.fy.begin(), ps.fy.end(), 0.0);
+  fields.uniforms.clear();
+  fields.attractors.push_back(AttractorField{Vec2{}, 2.0, 1.0, 0.0});
+  fields.apply(ps, 0.0);
+  assert(std::abs(ps.fx[0] + 1.0) < 1e-12);   // 2 * (1 - 0.5)
+  assert(ps.fy[0] == 0.0);
+  assert(ps.fx[1] == 0.0);
+
+  // Vortex: counter-clockwise at +x means +y
+  std::fill(ps.fx.begin(), ps.fx.end(), 0.0);
+  fields.attractors.clear();
+  fields.vortices.push_back(VortexField{Vec2{}, 2.0, 1.0, 0.0, 0.0});
+  fields.apply(ps, 0.0);
+  assert(std::abs(ps.fy[0] - 1.0) < 1e-12);
+  assert(std::abs(ps.fx[0]) < 1e-12);
+
+  // Turbulence is smooth and animated
+  TurbulenceField t;
+  double a[2] = {0.0, 0.0}, b[2] = {0.0, 0.0}, c[2] = {0.0, 0.0};
+  const double px[2] = {0.3, 0.3001};
+  const double py[2] = {0.7, 0.7};
+  const double zero[2] = {0.0, 0.0};
+  t.eval(FieldBatch{px, py, zero, zero, a, b, 2, 0.0});
+  assert(a[0] != 0.0 || b[0] != 0.0);
+  assert(std::abs(a[0] - a[1]) < 1e-2);
+  double d[2] = {0.0, 0.0};
+  t.eval(FieldBatch{px, py, zero, zero, c, d, 2, 1.0});
+  assert(c[0] != a[0]);
+
+  std::cout << "  ✓ Field kernel tests passed\n";
+}
+
+void test_field_bounding() {
+  std::cout << "Testing field spatial bounding...\n";
+
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> coord(-50.0, 50.0);
+  ParticleStore ps;
+  for (int i = 0; i < 10000; ++i) ps.add(Vec2{coord(rng), coord(rng)});
+
+  ForceFieldSet fields;
+  for (int k = 0; k < 24; ++k) {
+    fields.attractors.push_back(AttractorField{Vec2{-40.0 + 3.5 * k, 0.0}, 1.0, 2.0});
+  }
+  int custom_calls = 0;
+  fields.custom.push_back(CustomField{[&](const FieldBatch& b) {
+    ++custom_calls;
+    for (std::size_t i = 0; i < b.count; ++i) b.fy[i] += 1.0;
+  }, AABB{Vec2{0.0, 0.0}, Vec2{10.0, 10.0}}});
+  fields.apply(ps, 0.0);
+
+  // Each attractor covers ~0.16% of the domain; together they see a
+  // small fraction of the 240k particle-field combinations
+  assert(fields.stats().evaluations < 10000);
+  assert(custom_calls > 0 && custom_calls < 20);
+
+  // Bounded custom field: exactly the particles inside the box
+  const AABB box{Vec2{0.0, 0.0}, Vec2{10.0, 10.0}};
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    const bool near_attractor = std::abs(ps.y[i]) < 2.0;
+    if (near_attractor) continue;
+    assert((ps.fy[i] == 1.0) == box.contains(ps.position(i)));
+  }
+
+  std::cout << "  ✓ Field bounding tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Force Field Tests ===\n\n";
+
+  test_particle_grid();
+  test_field_kernels();
+  test_field_bounding();
+
+  std::cout << "\n✓ All force field tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,206 @@
+#define SIM_FP_VALIDATION 1
+#include "../include/debug/fp_validation.hpp"
+#include "../include/particles/adjoint.hpp"
+#include "../include/particles/ensemble.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+std::vector<FpEvent> g_events;
+
+void record_event(const FpEvent& e) { g_events.push_back(e); }
+
+void test_error_bounds() {
+  std::cout << "Testing error bounds...\n";
+
+  // Ten additions of 0.1: the bound covers the actual rounding error
+  Checked sum{0.0};
+  for (int k = 0; k < 10; ++k) sum += 0.1;
+  const long double exact = 10.0L * static_cast<long double>(0.1);
+  const double actual = static_cast<double>(std::abs(static_cast<long double>(sum.v) - exact));
+  assert(actual <= sum.err);
+  assert(sum.err < 1e-14);
+
+  // Cancellation: the bound grows to the size of the lost digits
+  const Checked big = Checked{1e16} + 1.0;
+  const Checked diff = big - 1e16;
+  assert(std::abs(diff.v - 1.0) <= diff.err);
+  assert(diff.relative_error() > 0.5);
+
+  // One operation on exact inputs: one rounding
+  const Checked p = Checked{3.0} * 4.0;
+  assert(p.v == 12.0 && p.relative_error() == Checked::kUnit);
+  const Checked q = p / 4.0;
+  assert(q.v == 3.0 && q.relative_error() <= 3.0 * Checked::kUnit);
+
+  // Comparisons look at the value
+  assert(q == 3.0 && q < p && -q < 0.0);
+
+  std::cout << "  ✓ Error bound tests passed\n";
+}
+
+void test_first_origin() {
+  std::cout << "Testing non-finite origins...\n";
+
+  {
+    const FpStepScope step(7, 42);
+    const FpPhase phase("solve");
+    assert(fp_first_event() == nullptr);
+
+    const Checked a = sqrt(Checked{-1.0});
+    assert(std::isnan(a.v));
+    const FpEvent* e = fp_first_event();
+    assert(e != nullptr && e->op == FpOp::sqrt && e->lhs == -1.0);
+    assert(e->step == 7 && e->id == 42 && std::strcmp(e->phase, "solve") == 0);
+
+    // Propagating an existing NaN is not a new origin
+    const Checked b = a * 2.0 + 1.0;
+    assert(std::isnan(b.v));
+    assert(fp_validation_state().origins == 1);
+
+    // A second origin is counted, the first one is kept
+    const Checked c = Checked{1.0} / 0.0;
+    assert(std::isinf(c.v));
+    assert(fp_validation_state().origins == 2);
+    assert(fp_first_event()->op == FpOp::sqrt);
+  }
+  {
+    // A new step starts clean; vector code reports through its components
+    const FpStepScope step(8);
+    assert(fp_first_event() == nullptr);
+    const CheckedVec2 v{1e200, 1e200};
+    const Checked len = v.length();
+    assert(std::isinf(len.v));
+    const FpEvent* e = fp_first_event();
+    assert(e != nullptr && e->op == FpOp::mul && e->lhs == 1e200 && e->step == 8);
+  }
+
+  std::cout << "  ✓ Non-finite origin tests passed\n";
+}
+
+void test_checked_kernel() {
+  std::cout << "Testing checked diff_step...\n";
+
+  DiffModel model;
+  model.inv_mass = {0.0, 1.0, 0.5};
+  model.springs = {Spring{0, 1}, Spring{1, 2}};
+
+  DiffParams p;
+  p.drag = 0.2;
+  p.stiffness = {60.0, 40.0};
+  p.rest_length = {0.5, 0.4};
+  BasicDiffParams<Checked> cp;
+  cp.gravity = CheckedVec2{p.gravity.x, p.gravity.y};
+  cp.drag = p.drag;
+  cp.stiffness = {p.stiffness[0], p.stiffness[1]};
+  cp.rest_length = {p.rest_length[0], p.rest_length[1]};
+
+  DiffState a(3), b(3);
+  a.x = {0.0, 0.4, 0.8};
+  a.y = {0.0, -0.3, -0.5};
+  BasicDiffState<Checked> ca(3), cb(3);
+  for (std::size_t i = 0; i < 3; ++i) {
+    ca.x[i] = a.x[i];
+    ca.y[i] = a.y[i];
+  }
+
+  constexpr double dt = 1.0 / 120.0;
+  const FpStepScope step(0);
+  for (int k = 0; k < 120; ++k) {
+    diff_step(model, p, a, b, dt);
+    diff_step(model, cp, ca, cb, dt);
+    std::swap(a, b);
+    std::swap(ca, cb);
+  }
+  // Same values as the double kernel up to rounding (which may contract
+  // to FMA differently), within a small, nonzero bound
+  for (std::size_t i = 0; i < 3; ++i) {
+    assert(std::abs(ca.x[i].v - a.x[i]) <= 2.0 * ca.x[i].err);
+    assert(std::abs(ca.vy[i].v - a.vy[i]) <= 2.0 * ca.vy[i].err);
+    assert(ca.x[i].err < 1e-10);
+  }
+  assert(ca.y[2].err > 0.0);
+  assert(fp_first_event() == nullptr);
+
+  std::cout << "  ✓ Checked diff_step tests passed\n";
+}
+
+void test_world_scan() {
+  std::cout << "Testing particle world scans...\n";
+
+  ParticleWorldParams params;
+  params.particles = 200;
+  params.seed = 5;
+  ParticleWorld world(params);
+  for (int k = 0; k < 10; ++k) world.step(1.0 / 240.0);
+
+  g_events.clear();
+  set_fp_report_hook(record_event);
+  world.particles().vx[17] = std::numeric_limits<double>::quiet_NaN();
+  world.step(1.0 / 240.0);
+
+  // Found by the first scan that saw it: x[17] after integration
+  assert(g_events.size() == 1);
+  const FpEvent& e = g_events[0];
+  assert(e.op == FpOp::check && std::strcmp(e.phase, "integrate") == 0);
+  assert(e.id == 5 && e.step == 10 && e.component == 0 && e.index == 17);
+
+  // The world halts where the NaN appeared: further steps do nothing,
+  // report nothing and keep the state for inspection
+  assert(world.halted());
+  for (int k = 0; k < 50; ++k) world.step(1.0 / 240.0);
+  set_fp_report_hook(nullptr);
+  assert(g_events.size() == 1);
+  assert(world.steps() == 11 && std::isnan(world.particles().x[17]));
+  const WorldSummary summary = summarize_world(world);
+  assert(summary.halted && !summary.finite && summary.steps == 11);
+
+  // One exploding world does not take the ensemble down
+  TaskPool pool(2);
+  Ensemble<ParticleWorld> ensemble(&pool);
+  for (const ParticleWorldParams& p : seed_sweep(params, 6)) ensemble.emplace(p);
+  ensemble.world(2).particles().vy[40] = std::numeric_limits<double>::infinity();
+  ensemble.run(60, 1.0 / 240.0);
+  const std::vector<WorldSummary> out = ensemble.collect(summarize_world);
+  for (std::size_t w = 0; w < out.size(); ++w) {
+    assert(out[w].halted == (w == 2) && out[w].finite == (w != 2));
+    assert(out[w].steps == (w == 2 ? 1u : 60u));
+  }
+
+  // reset() re-arms the scan
+  world.reset(6);
+  assert(!world.halted());
+  world.particles().fx[3] = std::numeric_limits<double>::infinity();
+  g_events.clear();
+  set_fp_report_hook(record_event);
+  world.step(1.0 / 240.0);
+  set_fp_report_hook(nullptr);
+  assert(g_events.size() == 1 && std::strcmp(g_events[0].phase, "pair_forces") == 0);
+  assert(g_events[0].component == 0 && g_events[0].index == 3);
+
+  std::cout << "  ✓ Particle world scan tests passed\n";
+}
+
+} // namespace
+
+int main() {
+  std::cout << "=== Running FP Validation Tests ===\n\n";
+
+  static_assert(kFpValidation);
+  static_assert(std::is_same_v<ValidationReal, Checked>);
+
+  test_error_bounds();
+  test_first_origin();
+  test_checked_kernel();
+  test_world_scan();
+
+  std::cout << "\n✓ All FP validation tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,173 @@
+#include "../include/dynamics/fracture.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace sim;
+
+void test_shatter_pattern() {
+  std::cout << "Testing shatter patterns...\n";
+
+  const Polygon box = make_box(2.0, 1.0);
+  const MassData md = compute_mass(box, 2.0);
+  assert(std::abs(md.mass - 16.0) < 1e-12);
+  assert(std::abs(md.inertia - 16.0 * (16.0 + 4.0) / 12.0) < 1e-9);
+  assert(md.center.length() < 1e-12);
+
+  ShatterLibrary library;
+  const PatternId id = library.add(box, 24, 7);
+  const ShatterPattern& pattern = library.pattern(id);
+  assert(pattern.pieces.size() == 24);
+  // Cells tile the shape (within the corner-dropping slack)
+  assert(std::abs(pattern.area() - 8.0) < 1e-3);
+  for (const ShatterPiece& p : pattern.pieces) {
+    assert(p.shape.count >= 3 && p.shape.count <= kMaxPolygonVertices);
+    assert(p.area > 0.0 && p.unit_inertia > 0.0);
+    // Stored about its own centroid, inside the source shape
+    assert(compute_mass(p.shape, 1.0).center.length() < 1e-9);
+    assert(std::abs(p.offset.x) <= 2.0 && std::abs(p.offset.y) <= 1.0);
+  }
+
+  // Same seed, same pattern
+  const Vec2 offset = pattern.pieces[5].offset;
+  const PatternId again = library.add(box, 24, 7);
+  assert(library.pattern(again).pieces[5].offset == offset);
+
+  std::cout << "  ✓ Shatter pattern tests passed\n";
+}
+
+void test_shatter_instancing() {
+  std::cout << "Testing shatter instancing...\n";
+
+  ShatterLibrary library;
+  const PatternId id = library.add(make_box(1.0, 1.0), 10, 3);
+  const ShatterPattern& pattern = library.pattern(id);
+
+  RigidBody source;
+  source.position = Vec2{5.0, 2.0};
+  source.angle = 0.5;
+  source.linear_velocity = Vec2{1.0, 0.0};
+  source.angular_velocity = 2.0;
+
+  DebrisConfig cfg;
+  cfg.density = 3.0;
+  cfg.burst_speed = 0.0;
+  DebrisSystem debris(cfg);
+  const Vec2 impulse{0.0, 12.0};
+  assert(debris.shatter(source, pattern, source.position, impulse) == pattern.pieces.size());
+
+  // Pieces sit where they were on the source, and momentum is conserved
+  const Transform2 xf = source.transform();
+  Vec2 momentum{};
+  double mass = 0.0;
+  for (std::size_t i = 0; i < debris.spawned().size(); ++i) {
+    const Debris* d = debris.get(debris.spawned()[i]);
+    assert(d != nullptr);
+    assert(d->body.position.distance_to(xf.apply(pattern.pieces[i].offset)) < 1e-12);
+    momentum += d->body.linear_velocity / d->body.inv_mass;
+    mass += 1.0 / d->body.inv_mass;
+  }
+  assert(std::abs(mass - 12.0) < 1e-6);
+  assert(momentum.distance_to(source.linear_velocity * mass + impulse) < 1e-6);
+
+  std::cout << "  ✓ Shatter instancing tests passed\n";
+}
+
+void test_shatter_budget() {
+  std::cout << "Testing shatter under a debris budget...\n";
+
+  ShatterLibrary library;
+  const PatternId id = library.add(make_box(1.0, 1.0), 10, 5);
+  const ShatterPattern& pattern = library.pattern(id);
+
+  RigidBody source;
+  source.position = Vec2{-3.0, 4.0};
+  source.linear_velocity = Vec2{0.5, -1.0};
+
+  // Fewer slots than pieces: the spawned pieces still take all of impulse
+  DebrisConfig cfg;
+  cfg.density = 2.0;
+  cfg.max_debris = 4;
+  cfg.burst_speed = 0.0;
+  DebrisSystem debris(cfg);
+  const Vec2 impulse{6.0, -2.0};
+  assert(debris.shatter(source, pattern, source.position, impulse) == 4);
+  Vec2 momentum{};
+  double mass = 0.0;
+  for (const auto h : debris.spawned()) {
+    const Debris* d = debris.get(h);
+    momentum += d->body.linear_velocity / d->body.inv_mass;
+    mass += 1.0 / d->body.inv_mass;
+  }
+  assert(mass < cfg.density * pattern.area());
+  assert(momentum.distance_to(source.linear_velocity * mass + impulse) < 1e-9);
+
+  // Without an impact point the burst is centred on the source body
+  cfg.max_debris = 64;
+  cfg.burst_speed = 3.0;
+  DebrisSystem burst(cfg);
+  source.linear_velocity = Vec2{};
+  assert(burst.shatter(source, pattern) == pattern.pieces.size());
+  for (const auto h : burst.spawned()) {
+    const Debris* d = burst.get(h);
+    const Vec2 out = (d->body.position - source.position).normalized();
+    assert(d->body.linear_velocity.distance_to(out * cfg.burst_speed) < 1e-9);
+  }
+
+  std::cout << "  ✓ Shatter budget tests passed\n";
+}
+
+void test_debris_pooling() {
+  std::cout << "Testing debris pooling...\n";
+
+  ShatterLibrary library;
+  const PatternId id = library.add(make_box(1.0, 1.0), 16, 9);
+
+  DebrisConfig cfg;
+  cfg.lifetime = 0.5;
+  cfg.max_debris = 40;
+  cfg.burst_speed = 2.0;
+  DebrisSystem debris(cfg);
+  const std::uint64_t slabs = debris.pool_stats().slab_allocations;
+
+  RigidBody source;
+  for (int i = 0; i < 50; ++i) {
+    source.position = Vec2{static_cast<double>(i), 0.0};
+    debris.shatter(source, library.pattern(id), source.position);
+    assert(debris.size() <= cfg.max_debris);     // budget retires the oldest
+    for (int s = 0; s < 6; ++s) debris.step(Vec2{0.0, -10.0}, 1.0 / 60.0);
+  }
+  // Breaking never allocates once the pool covers the budget
+  assert(debris.pool_stats().slab_allocations == slabs);
+  assert(debris.pool_stats().reuses > 0);
+
+  // Everything expires
+  for (int s = 0; s < 60; ++s) debris.step(Vec2{}, 1.0 / 60.0);
+  assert(debris.size() == 0);
+
+  // Contact impulse trigger
+  ContactConstraint c;
+  c.body_a = 0;
+  c.body_b = 3;
+  c.count = 2;
+  c.points[0].normal_impulse = 1.5;
+  c.points[1].normal_impulse = 2.0;
+  const ContactConstraint cs[] = {c};
+  const Breakable crate{3, id, 3.0};
+  assert(contact_impulse(cs, crate.body) > crate.threshold);
+  assert(contact_impulse(cs, 1) == 0.0);
+
+  std::cout << "  ✓ Debris pooling tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Fracture Tests ===\n\n";
+
+  test_shatter_pattern();
+  test_shatter_instancing();
+  test_shatter_budget();
+  test_debris_pooling();
+
+  std::cout << "\n✓ All fracture tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,186 @@
+#include "../include/collision/gjk.hpp"
+#include "../include/collision/sat.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace sim;
+
+void test_gjk_circles() {
+  std::cout << "Testing GJK circle distance...\n";
+
+  ConvexProxy a = make_circle(Vec2{}, 0.5);
+  ConvexProxy b = make_circle(Vec2{}, 0.25);
+  SimplexCache cache;
+
+  DistanceOutput out = gjk_distance(a, Transform2{}, b, Transform2{Vec2{2.0, 0.0}, Rot2{}}, cache);
+  assert(std::abs(out.distance - 1.25) < 1e-12);
+  assert(std::abs(out.point_a.x - 0.5) < 1e-12);
+  assert(std::abs(out.point_b.x - 1.75) < 1e-12);
+  assert(std::abs(out.normal.x - 1.0) < 1e-12);
+
+  std::cout << "  ✓ Circle distance tests passed\n";
+}
+
+void test_gjk_capsule_box() {
+  std::cout << "Testing GJK capsule vs box...\n";
+
+  ConvexProxy box = make_proxy(make_box(1.0, 1.0));
+  ConvexProxy capsule = make_capsule(Vec2{-1.0, 0.0}, Vec2{1.0, 0.0}, 0.25);
+  SimplexCache cache;
+
+  // Horizontal capsule hovering above the box
+  Transform2 xf{Vec2{0.3, 2.0}, Rot2{}};
+  DistanceOutput out = gjk_distance(box, Transform2{}, capsule, xf, cache);
+  assert(std::abs(out.distance - 0.75) < 1e-12);
+  assert(std::abs(out.normal.y - 1.0) < 1e-12);
+  assert(std::abs(out.point_a.y - 1.0) < 1e-12);
+  assert(std::abs(out.point_b.y - 1.75) < 1e-12);
+
+  std::cout << "  ✓ Capsule vs box tests passed\n";
+}
+
+void test_gjk_warm_start() {
+  std::cout << "Testing GJK warm start...\n";
+
+  ConvexProxy a = make_proxy(make_box(0.5, 0.5), 0.05);
+  ConvexProxy b = make_proxy(make_box(0.5, 0.5), 0.05);
+  SimplexCache cache;
+
+  Transform2 xf{Vec2{1.4, 0.7}, Rot2::from_angle(0.3)};
+  DistanceOutput cold = gjk_distance(a, Transform2{}, b, xf, cache);
+
+  // Resting pair: the cached simplex is already the answer
+  DistanceOutput warm = gjk_distance(a, Transform2{}, b, xf, cache);
+  assert(warm.iterations <= 1);
+  assert(warm.iterations <= cold.iterations);
+  assert(std::abs(warm.distance - cold.distance) < 1e-12);
+
+  // Small motion between steps still converges quickly
+  xf.p += Vec2{0.001, -0.001};
+  DistanceOutput moved = gjk_distance(a, Transform2{}, b, xf, cache);
+  assert(moved.iterations <= 2);
+
+  std::cout << "  ✓ Warm start tests passed\n";
+}
+
+void test_epa_boxes() {
+  std::cout << "Testing EPA box penetration...\n";
+
+  ConvexProxy a = make_proxy(make_box(0.5, 0.5));
+  ConvexProxy b = make_proxy(make_box(0.5, 0.5));
+  SimplexCache cache;
+
+  PenetrationOutput out = epa_penetration(a, Transform2{}, b, Transform2{Vec2{0.2, 0.9}, Rot2{}}, cache);
+  assert(std::abs(out.separation + 0.1) < 1e-9);
+  assert(std::abs(out.normal.x) < 1e-9 && std::abs(out.normal.y - 1.0) < 1e-9);
+  assert(std::abs(out.point_a.y - 0.5) < 1e-9);
+  assert(std::abs(out.point_b.y - 0.4) < 1e-9);
+
+  // Every side and both axes: the depth and normal follow the shallow axis
+  // whichever way round the final GJK triangle is wound
+  const Vec2 offsets[] = {{0.9, 0.2}, {-0.9, 0.2}, {0.9, -0.2}, {-0.9, -0.2},
+                          {0.1, 0.3}, {0.1, -0.3}, {-0.1, 0.3}, {-0.1, -0.3}};
+  for (const Vec2& d : offsets) {
+    const bool along_x = std::abs(d.x) > std::abs(d.y);
+    const double depth = 1.0 - (along_x ? std::abs(d.x) : std::abs(d.y));
+    const Vec2 normal = along_x ? Vec2{d.x > 0.0 ? 1.0 : -1.0, 0.0}
+                                : Vec2{0.0, d.y > 0.0 ? 1.0 : -1.0};
+    SimplexCache c;
+    for (int k = 0; k < 2; ++k) {  // cold, then warm-started from the cache
+      const PenetrationOutput p = epa_penetration(a, Transform2{}, b, Transform2{d, Rot2{}}, c);
+      assert(std::abs(p.separation + depth) < 1e-9);
+      assert(p.normal.distance_to(normal) < 1e-9);
+    }
+  }
+
+  // Separated pair goes through GJK and reports a positive separation
+  SimplexCache cache2;
+  PenetrationOutput sep = epa_penetration(a, Transform2{}, b, Transform2{Vec2{1.5, 0.0}, Rot2{}}, cache2);
+  assert(std::abs(sep.separation - 0.5) < 1e-9);
+
+  std::cout << "  ✓ EPA box tests passed\n";
+}
+
+void test_epa_rounded() {
+  std::cout << "Testing EPA with rounded shapes...\n";
+
+  // Overlapping radii, disjoint cores: no EPA needed
+  ConvexProxy a = make_circle(Vec2{}, 1.0);
+  ConvexProxy b = make_circle(Vec2{}, 1.0);
+  SimplexCache cache;
+  PenetrationOutput out = epa_penetration(a, Transform2{}, b, Transform2{Vec2{0.0, 1.5}, Rot2{}}, cache);
+  assert(std::abs(out.separation + 0.5) < 1e-12);
+  assert(std::abs(out.normal.y - 1.0) < 1e-12);
+
+  // Crossing capsule cores: EPA over a segment-segment difference
+  ConvexProxy c1 = make_capsule(Vec2{-1.0, 0.0}, Vec2{1.0, 0.0}, 0.1);
+  ConvexProxy c2 = make_capsule(Vec2{0.0, -1.0}, Vec2{0.0, 1.0}, 0.1);
+  SimplexCache cache2;
+  PenetrationOutput cross = epa_penetration(c1, Transform2{}, c2, Transform2{Vec2{0.0, 0.8}, Rot2{}}, cache2);
+  assert(std::abs(cross.separation + (0.2 + 0.2)) < 1e-9);
+  assert(std::abs(cross.normal.y - 1.0) < 1e-9);
+
+  std::cout << "  ✓ Rounded shape tests passed\n";
+}
+
+void test_epa_matches_sat() {
+  std::cout << "Testing EPA against SAT...\n";
+
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<double> half(0.1, 1.0);
+  std::uniform_real_distribution<double> coord(-1.5, 1.5);
+  std::uniform_real_distribution<double> angle(-3.14159, 3.14159);
+
+  int overlapping = 0;
+  for (int trial = 0; trial < 4000; ++trial) {
+    const Polygon pa = make_box(half(rng), half(rng));
+    const Polygon pb = make_box(half(rng), half(rng));
+    const Transform2 xfa{Vec2{coord(rng), coord(rng)}, Rot2::from_angle(angle(rng))};
+    const Transform2 xfb{Vec2{coord(rng), coord(rng)}, Rot2::from_angle(angle(rng))};
+
+    // SAT depth: the larger of the two polygons' best face separations
+    const Polygon lb = detail::to_frame(pb, xfa.inv_mul(xfb));
+    const Polygon la = detail::to_frame(pa, xfb.inv_mul(xfa));
+    int edge = 0;
+    const double sat = std::max(detail::find_max_separation(pa, lb, edge),
+                                detail::find_max_separation(pb, la, edge));
+    if (sat >= -1e-6) continue;
+    ++overlapping;
+
+    const ConvexProxy a = make_proxy(pa);
+    const ConvexProxy b = make_proxy(pb);
+    SimplexCache cache;
+    const PenetrationOutput cold = epa_penetration(a, xfa, b, xfb, cache);
+    const PenetrationOutput warm = epa_penetration(a, xfa, b, xfb, cache);
+
+    for (const PenetrationOutput& p : {cold, warm}) {
+      assert(std::abs(p.separation - sat) < 1e-7);
+      // The normal is an axis that actually achieves that separation
+      double max_a = -1e300;
+      double min_b = 1e300;
+      for (int i = 0; i < a.count; ++i) max_a = std::max(max_a, p.normal.dot(xfa.apply(a.vertices[i])));
+      for (int i = 0; i < b.count; ++i) min_b = std::min(min_b, p.normal.dot(xfb.apply(b.vertices[i])));
+      assert(std::abs((min_b - max_a) - p.separation) < 1e-7);
+    }
+  }
+  assert(overlapping > 1000);
+
+  std::cout << "  ✓ EPA vs SAT tests passed\n";
+}
+
+int main() {
+  std::cout << "\n=== Running GJK/EPA Tests ===\n\n";
+
+  test_gjk_circles();
+  test_gjk_capsule_box();
+  test_gjk_warm_start();
+  test_epa_boxes();
+  test_epa_rounded();
+  test_epa_matches_sat();
+
+  std::cout << "\n✓ All GJK/EPA tests passed!\n\n";
+  return 0;
+}
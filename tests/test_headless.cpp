@@ -0,0 +1,143 @@
+#include "../include/render/frame_writer.hpp"
+#include "../include/render/raster.hpp"
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+using namespace sim;
+
+namespace {
+
+constexpr Color kRed{255, 0, 0, 255};
+
+std::uint32_t read_u32_be(const std::vector<std::uint8_t>& b, std::size_t at) {
+  return (std::uint32_t{b[at]} << 24) | (std::uint32_t{b[at + 1]} << 16) |
+         (std::uint32_t{b[at + 2]} << 8) | std::uint32_t{b[at + 3]};
+}
+
+} // namespace
+
+void test_rasterizer() {
+  std::cout << "Testing rasterizer...\n";
+
+  RasterView view;
+  view.world = AABB{Vec2{0.0, 0.0}, Vec2{10.0, 10.0}};
+  view.width = 100;
+  view.height = 100;
+  Rasterizer r(view);
+  r.clear(Color{0, 0, 0, 255});
+
+  // World y is up, image row 0 is the top
+  r.fill_circle(Vec2{2.0, 8.0}, 0.5, kRed);
+  assert(r.image().at(20, 20).r == 255);
+  assert(r.image().at(20, 80).r == 0);
+  assert(r.image().at(26, 20).r == 0);
+
+  // Unit box: 10 x 10 pixels
+  r.fill_polygon(make_box(0.5, 0.5), Transform2{Vec2{5.0, 5.0}, Rot2{}}, kRed);
+  int filled = 0;
+  for (int y = 40; y < 60; ++y) {
+    for (int x = 40; x < 60; ++x) filled += r.image().at(x, y).r == 255 ? 1 : 0;
+  }
+  assert(filled == 100);
+
+  // Sub-pixel particles still show up
+  ParticleDrawList draw;
+  draw.push(9.05, 0.05, 0.001);
+  r.draw_particles(draw, Color{0, 255, 0, 255});
+  assert(r.image().at(90, 99).g == 255);
+
+  // Off-image geometry is clipped, not written out of bounds
+  r.fill_circle(Vec2{-5.0, -5.0}, 20.0, kRed);
+  r.draw_line(Vec2{-100.0, 5.0}, Vec2{100.0, 5.0}, kRed);
+
+  std::cout << "  ✓ Rasterizer tests passed\n";
+}
+
+void test_encoders() {
+  std::cout << "Testing image encoders...\n";
+
+  Image img(300, 250);   // > 65535 raw bytes: several stored blocks
+  img.set(7, 3, kRed);
+
+  const std::vector<std::uint8_t> png = encode_png(img);
+  assert(png[0] == 0x89 && png[1] == 'P' && png[2] == 'N' && png[3] == 'G');
+  assert(read_u32_be(png, 8) == 13);                           // IHDR length
+  assert(read_u32_be(png, 16) == 300 && read_u32_be(png, 20) == 250);
+  assert(read_u32_be(png, 29) == detail::crc32(png.data() + 12, 17));
+  // Known CRC of an empty IEND chunk
+  assert(read_u32_be(png, png.size() - 4) == 0xAE426082u);
+
+  // Stored blocks decode back to the scanlines
+  std::size_t at = 8 + 25 + 8 + 2;   // into the IDAT zlib payload
+  std::vector<std::uint8_t> raw;
+  for (bool last = false; !last;) {
+    last = png[at] & 1;
+    const std::size_t len = png[at + 1] | (png[at + 2] << 8);
+    assert(static_cast<std::size_t>((png[at + 3] | (png[at + 4] << 8)) ^ 0xFFFF) == len);
+    raw.insert(raw.end(), png.begin() + static_cast<std::ptrdiff_t>(at + 5),
+               png.begin() + static_cast<std::ptrdiff_t>(at + 5 + len));
+    at += 5 + len;
+  }
+  assert(raw.size() == 250u * (300 * 4 + 1));
+  assert(raw[3 * (300 * 4 + 1) + 1 + 7 * 4] == 255);
+
+  const std::vector<std::uint8_t> ppm = encode_ppm(img);
+  const std::string header = "P6\n300 250\n255\n";
+  assert(std::string(ppm.begin(), ppm.begin() + 15) == header);
+  assert(ppm.size() == header.size() + 300u * 250 * 3);
+
+  std::cout << "  ✓ Encoder tests passed\n";
+}
+
+void test_frame_writer() {
+  std::cout << "Testing frame writer...\n";
+
+  namespace fs = std::filesystem;
+  const fs::path dir = fs::temp_directory_path() / "sim_test_headless";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+
+  {
+    FrameWriter writer((dir / "f_").string(), ImageFormat::ppm, 2);
+    for (int i = 0; i < 10; ++i) {
+      Image img(32, 16);
+      img.set(i, 0, kRed);
+      writer.submit(std::move(img));
+    }
+    writer.flush();
+    const FrameWriterStats st = writer.stats();
+    assert(st.submitted == 10 && st.written == 10 && st.failed == 0);
+    assert(writer.frame_path(3) == (dir / "f_000003.ppm").string());
+  }
+  for (int i = 0; i < 10; ++i) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "f_%06d.ppm", i);
+    assert(fs::file_size(dir / name) == std::string("P6\n32 16\n255\n").size() + 32 * 16 * 3);
+  }
+
+  // Destruction drains the queue, and write failures are counted
+  FrameWriterStats bad;
+  {
+    FrameWriter writer((dir / "missing" / "f_").string(), ImageFormat::png);
+    writer.submit(Image(4, 4));
+    writer.flush();
+    bad = writer.stats();
+  }
+  assert(bad.failed == 1 && bad.written == 0);
+
+  fs::remove_all(dir);
+  std::cout << "  ✓ Frame writer tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Headless Rendering Tests ===\n\n";
+
+  test_rasterizer();
+  test_encoders();
+  test_frame_writer();
+
+  std::cout << "\n✓ All headless rendering tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,151 @@
+#include "../include/debug/inspector.hpp"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+
+using namespace sim;
+
+void test_published_state() {
+  std::cout << "Testing published state...\n";
+
+  PublishedState<int> state;
+  assert(!state.acquire());              // nothing published yet
+
+  state.write_buffer() = 1;
+  state.publish();
+  state.write_buffer() = 2;
+  state.publish();
+  assert(state.acquire() && state.read_buffer() == 2);   // newest wins
+  assert(!state.acquire() && state.read_buffer() == 2);  // still held
+
+  // Writer and reader on separate threads: frames are never torn and
+  // never go backwards
+  struct Frame {
+    std::uint64_t a{0};
+    std::uint64_t b{0};
+  };
+  PublishedState<Frame> frames;
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (std::uint64_t i = 1; i <= 200000; ++i) {
+      Frame& f = frames.write_buffer();
+      f.a = i;
+      f.b = i * 3;
+      frames.publish();
+    }
+    done = true;
+  });
+  std::uint64_t last = 0;
+  std::uint64_t seen = 0;
+  for (;;) {
+    const bool finished = done;
+    if (!frames.acquire()) {
+      if (finished) break;
+      continue;
+    }
+    const Frame& f = frames.read_buffer();
+    assert(f.b == f.a * 3);
+    assert(f.a > last);
+    last = f.a;
+    ++seen;
+  }
+  writer.join();
+  assert(seen > 0 && last == 200000);
+
+  std::cout << "  ✓ Published state tests passed\n";
+}
+
+void test_capture_gating() {
+  std::cout << "Testing inspector capture gating...\n";
+
+  std::vector<RigidBody> bodies(3);
+  bodies[1].position = Vec2{1.0, 2.0};
+  bodies[1].inv_mass = 0.5;
+  ContactConstraint c;
+  c.body_a = 0;
+  c.body_b = 1;
+  c.count = 2;
+  c.points[0].normal_impulse = 1.0;
+  c.points[1].normal_impulse = 2.0;
+  c.points[0].separation = -0.01;
+  c.points[1].separation = -0.03;
+  const ContactConstraint contacts[] = {c};
+
+  auto step = [&](InspectorCapture& cap, std::uint64_t n) {
+    cap.begin_step();
+    {
+      InspectorPhase phase(cap, "solve");
+    }
+    cap.capture_bodies(bodies);
+    cap.capture_contacts(contacts);
+    cap.end_step(n);
+  };
+
+  // All panels closed: nothing is captured or published
+  InspectorCapture capture;
+  step(capture, 1);
+  assert(!capture.acquire());
+
+  // Bodies panel only
+  capture.set_open_panels(kPanelBodies);
+  step(capture, 2);
+  assert(capture.acquire());
+  const InspectorFrame& f = capture.frame();
+  assert(f.step == 2 && f.panels == kPanelBodies);
+  assert(f.bodies.size() == 3 && f.bodies[1].position == Vec2(1.0, 2.0));
+  assert(f.contacts.empty() && f.phase_count == 0);
+
+  // Everything
+  capture.set_open_panels(kPanelBodies | kPanelContacts | kPanelTimings);
+  step(capture, 3);
+  assert(capture.acquire());
+  const InspectorFrame& g = capture.frame();
+  assert(g.contacts.size() == 1);
+  assert(g.contacts[0].normal_impulse == 3.0 && g.contacts[0].min_separation == -0.03);
+  assert(g.phase_count == 1 && g.phase_ms[0] >= 0.0);
+
+  // Closing again stops publishing; the UI keeps its last frame
+  capture.set_open_panels(kPanelNone);
+  step(capture, 4);
+  assert(!capture.acquire() && capture.frame().step == 3);
+
+  std::cout << "  ✓ Capture gating tests passed\n";
+}
+
+void test_timing_history() {
+  std::cout << "Testing timing history...\n";
+
+  TimingHistory<4> history;
+  InspectorFrame f;
+  f.panels = kPanelTimings;
+  f.phase_count = 2;
+  f.phase_names = {"a", "b"};
+  for (int i = 0; i < 6; ++i) {
+    f.phase_ms[0] = i;
+    f.phase_ms[1] = 10.0 * i;
+    history.push(f);
+  }
+  assert(history.size() == 4 && history.phase_count() == 2);
+  assert(history.latest(0) == 5.0f && history.latest(1) == 50.0f);
+  // Oldest sample sits at offset()
+  assert(history.samples(0)[history.offset()] == 2.0f);
+
+  // Frames without timings are ignored
+  f.panels = kPanelBodies;
+  history.push(f);
+  assert(history.latest(0) == 5.0f);
+
+  std::cout << "  ✓ Timing history tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Inspector Tests ===\n\n";
+
+  test_published_state();
+  test_capture_gating();
+  test_timing_history();
+
+  std::cout << "\n✓ All inspector tests passed!\n\n";
+  return 0;
+}
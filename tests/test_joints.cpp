@@ -0,0 +1,190 @@
+#include "../include/dynamics/joints.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+constexpr double kDt = 1.0 / 60.0;
+constexpr int kIterations = 10;
+
+RigidBody make_static(const Vec2& p) {
+  RigidBody b;
+  b.position = p;
+  return b;
+}
+
+RigidBody make_dynamic(const Vec2& p, double mass = 1.0, double inertia = 1.0 / 6.0) {
+  RigidBody b;
+  b.position = p;
+  b.inv_mass = 1.0 / mass;
+  b.inv_inertia = 1.0 / inertia;
+  return b;
+}
+
+void run(std::vector<RigidBody>& bodies, JointSet& joints, int steps,
+         const Vec2& gravity = Vec2{0.0, -10.0}) {
+  for (int i = 0; i < steps; ++i) {
+    integrate_velocities(bodies, gravity, kDt);
+    joints.solve(bodies, kDt, kIterations);
+    integrate_positions(bodies, kDt);
+  }
+}
+
+Vec2 world_anchor(const RigidBody& b, const Vec2& local) {
+  return b.transform().apply(local);
+}
+
+} // namespace
+
+void test_revolute_pendulum() {
+  std::cout << "Testing revolute pendulum...\n";
+
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{1.0, 0.0})};
+  JointSet joints;
+  joints.revolute.add(RevoluteJointDef{.body_a = 0, .body_b = 1,
+                                       .local_anchor_b = Vec2{-1.0, 0.0}});
+
+  run(bodies, joints, 120);
+  const Vec2 drift = world_anchor(bodies[1], Vec2{-1.0, 0.0}) - world_anchor(bodies[0], Vec2{});
+  assert(drift.length() < 0.02);
+  assert(bodies[1].position.y < -0.1);
+
+  std::cout << "  ✓ Revolute pendulum tests passed\n";
+}
+
+void test_revolute_motor_and_limit() {
+  std::cout << "Testing revolute motor and limits...\n";
+
+  // Motor spins a wheel pinned at its centre
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{})};
+  JointSet joints;
+  joints.revolute.add(RevoluteJointDef{.body_a = 0, .body_b = 1, .enable_motor = true,
+                                       .motor_speed = 2.0, .max_motor_torque = 1000.0});
+  run(bodies, joints, 10, Vec2{});
+  assert(std::abs(bodies[1].angular_velocity - 2.0) < 1e-6);
+
+  // Limited pendulum cannot swing past the lower angle
+  std::vector<RigidBody> arm{make_static(Vec2{}), make_dynamic(Vec2{1.0, 0.0})};
+  JointSet limited;
+  limited.revolute.add(RevoluteJointDef{.body_a = 0, .body_b = 1,
+                                        .local_anchor_b = Vec2{-1.0, 0.0},
+                                        .enable_limit = true,
+                                        .lower_angle = -0.25, .upper_angle = 0.25});
+  run(arm, limited, 120);
+  assert(arm[1].angle > -0.25 - 0.02);
+
+  std::cout << "  ✓ Revolute motor and limit tests passed\n";
+}
+
+void test_prismatic() {
+  std::cout << "Testing prismatic slider...\n";
+
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{})};
+  JointSet joints;
+  joints.prismatic.add(PrismaticJointDef{.body_a = 0, .body_b = 1,
+                                         .enable_limit = true,
+                                         .lower_translation = -1.0, .upper_translation = 0.5,
+                                         .enable_motor = true,
+                                         .motor_speed = 1.0, .max_motor_force = 100.0});
+
+  run(bodies, joints, 20);
+  assert(std::abs(bodies[1].position.y) < 1e-3);
+  assert(std::abs(bodies[1].linear_velocity.x - 1.0) < 1e-3);
+  assert(std::abs(bodies[1].angle) < 1e-3);
+
+  run(bodies, joints, 60);
+  assert(bodies[1].position.x < 0.5 + 0.02);
+  assert(bodies[1].position.x > 0.4);
+
+  std::cout << "  ✓ Prismatic tests passed\n";
+}
+
+void test_weld() {
+  std::cout << "Testing weld joint...\n";
+
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{1.0, 0.0})};
+  JointSet joints;
+  joints.weld.add(WeldJointDef{.body_a = 0, .body_b = 1,
+                               .local_anchor_a = Vec2{0.5, 0.0},
+                               .local_anchor_b = Vec2{-0.5, 0.0}});
+
+  run(bodies, joints, 120);
+  assert(bodies[1].position.distance_to(Vec2{1.0, 0.0}) < 0.02);
+  assert(std::abs(bodies[1].angle) < 0.02);
+
+  std::cout << "  ✓ Weld tests passed\n";
+}
+
+void test_distance_and_rope() {
+  std::cout << "Testing distance and rope joints...\n";
+
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{1.0, 0.0}),
+                                make_dynamic(Vec2{0.0, -0.5})};
+  JointSet joints;
+  joints.distance.add(DistanceJointDef{.body_a = 0, .body_b = 1, .length = 1.0});
+  joints.rope.add(RopeJointDef{.body_a = 0, .body_b = 2, .max_length = 1.0});
+
+  // Rope is slack: free fall for the first few steps
+  run(bodies, joints, 5);
+  assert(bodies[2].position.y < -0.5);
+
+  run(bodies, joints, 115);
+  assert(std::abs(bodies[1].position.length() - 1.0) < 0.02);
+  assert(bodies[2].position.length() < 1.0 + 0.02);
+  assert(bodies[2].position.length() > 0.95);
+
+  std::cout << "  ✓ Distance and rope tests passed\n";
+}
+
+void test_motor_joint() {
+  std::cout << "Testing motor joint...\n";
+
+  std::vector<RigidBody> bodies{make_static(Vec2{}), make_dynamic(Vec2{})};
+  JointSet joints;
+  joints.motor.add(MotorJointDef{.body_a = 0, .body_b = 1,
+                                 .linear_offset = Vec2{2.0, 0.0}, .angular_offset = 0.5,
+                                 .max_force = 100.0, .max_torque = 100.0});
+
+  run(bodies, joints, 180, Vec2{});
+  assert(bodies[1].position.distance_to(Vec2{2.0, 0.0}) < 0.01);
+  assert(std::abs(bodies[1].angle - 0.5) < 0.01);
+
+  std::cout << "  ✓ Motor joint tests passed\n";
+}
+
+void test_batch_layout() {
+  std::cout << "Testing joint batch layout...\n";
+
+  DistanceBatch batch;
+  batch.add(DistanceJointDef{.body_a = 0, .body_b = 1, .length = 1.0});
+  batch.add(DistanceJointDef{.body_a = 0, .body_b = 2, .length = 2.0});
+  batch.add(DistanceJointDef{.body_a = 0, .body_b = 3, .length = 3.0});
+  assert(batch.size() == 3);
+
+  batch.remove(0);
+  assert(batch.size() == 2);
+  assert(batch.body_b[0] == 3 && batch.length[0] == 3.0);
+  assert(batch.body_b[1] == 2 && batch.length[1] == 2.0);
+  assert(batch.impulse.size() == 2);
+
+  std::cout << "  ✓ Batch layout tests passed\n";
+}
+
+int main() {
+  std::cout << "\n=== Running Joint Tests ===\n\n";
+
+  test_revolute_pendulum();
+  test_revolute_motor_and_limit();
+  test_prismatic();
+  test_weld();
+  test_distance_and_rope();
+  test_motor_joint();
+  test_batch_layout();
+
+  std::cout << "\n✓ All joint tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,236 @@
+#include "../include/collision/sat.hpp"
+#include "../include/dynamics/contact_solver.hpp"
+#include "../include/particles/particle_collision.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+using namespace sim;
+
+void test_material_table() {
+  std::cout << "Testing material pair table...\n";
+
+  MaterialTable table;
+  assert(table.size() == 1);
+  const MaterialId rubber = table.add(Material{0.9, 0.8, 0.0, CombineRule::geometric, CombineRule::max});
+  const MaterialId ice = table.add(Material{0.04, 0.1, 0.0, CombineRule::min, CombineRule::average});
+
+  // Symmetric, and min beats geometric for friction
+  const MaterialPair& ri = table.pair(rubber, ice);
+  const MaterialPair& ir = table.pair(ice, rubber);
+  assert(ri.friction == ir.friction && ri.restitution == ir.restitution);
+  assert(std::abs(ri.friction - 0.04) < 1e-12);
+  assert(std::abs(ri.restitution - 0.8) < 1e-12);  // max beats average
+  assert(std::abs(table.pair(rubber, rubber).friction - 0.9) < 1e-12);
+  assert(std::abs(table.pair(kDefaultMaterial, rubber).friction - std::sqrt(0.6 * 0.9)) < 1e-12);
+
+  // Overrides survive adding materials and editing others
+  table.override_pair(rubber, ice, MaterialPair{0.5, 0.0, 0.0});
+  const MaterialId wood = table.add(Material{0.5, 0.2});
+  table.set(rubber, Material{1.0, 0.7});
+  assert(table.pair(ice, rubber).friction == 0.5);
+  assert(std::abs(table.pair(rubber, wood).friction - std::sqrt(0.5)) < 1e-12);
+  assert(std::abs(table.pair(rubber, rubber).restitution - 0.7) < 1e-12);
+
+  std::cout << "  ✓ Material table tests passed\n";
+}
+
+namespace {
+
+/// Box resting on a 20 degree ramp; returns how far it slid in 2 s
+double slide_distance(double box_friction) {
+  MaterialTable table;
+  const MaterialId ramp_mat = table.add(Material{box_friction, 0.0});
+  const MaterialId box_mat = table.add(Material{box_friction, 0.0});
+
+  const double angle = 20.0 * std::numbers::pi / 180.0;
+  const Rot2 q = Rot2::from_angle(angle);
+  const Polygon ground_shape = make_box(10.0, 0.5);
+  const Polygon box_shape = make_box(0.5, 0.5);
+
+  std::vector<RigidBody> bodies(2);
+  bodies[0].angle = angle;
+  bodies[0].material = ramp_mat;
+  bodies[1].position = q.apply(Vec2{0.0, 1.0 - 0.01});
+  bodies[1].angle = angle;
+  bodies[1].inv_mass = 1.0;
+  bodies[1].inv_inertia = 6.0;
+  bodies[1].material = box_mat;
+  const Vec2 start = bodies[1].position;
+
+  ContactSolver solver;
+  SatCache cache;
+  ContactConstraint previous{};
+  const double dt = 1.0 / 60.0;
+  for (int step = 0; step < 120; ++step) {
+    integrate_velocities(bodies, Vec2{0.0, -9.81}, dt);
+    solver.clear();
+    const Manifold m = collide_polygons(ground_shape, bodies[0].transform(), box_shape,
+                                        bodies[1].transform(), cache, 0.02);
+    if (!m.empty()) {
+      ContactConstraint& c = solver.add(0, 1, m, bodies, table);
+      ContactSolver::match_impulses(c, previous);
+    }
+    solver.solve(bodies, dt, 8);
+    if (solver.size() > 0) previous = solver.constraints()[0];
+    integrate_positions(bodies, dt);
+  }
+  return (bodies[1].position - start).length();
+}
+
+} // namespace
+
+void test_contact_friction_restitution() {
+  std::cout << "Testing contact friction and restitution...\n";
+
+  // tan(20 deg) = 0.36: sticks above, slides below
+  const double stick = slide_distance(0.8);
+  const double slide = slide_distance(0.1);
+  assert(stick < 0.05);
+  // Analytic: 0.5 * g (sin - mu cos) t^2 = 4.87 m
+  assert(slide > 4.0 && slide < 5.5);
+
+  // Head-on impact against a static body: rebound = e * approach speed
+  MaterialTable table;
+  const MaterialId bouncy = table.add(Material{0.0, 0.5});
+  std::vector<RigidBody> bodies(2);
+  bodies[0].material = bouncy;
+  bodies[1].position = Vec2{0.0, 1.0};
+  bodies[1].linear_velocity = Vec2{0.0, -4.0};
+  bodies[1].inv_mass = 1.0;
+  bodies[1].material = bouncy;
+
+  Manifold m;
+  m.normal = Vec2{0.0, 1.0};
+  m.count = 1;
+  m.points[0].point = Vec2{0.0, 0.5};
+  ContactSolver solver;
+  solver.add(0, 1, m, bodies, table);
+  solver.solve(bodies, 1.0 / 60.0, 10);
+  assert(std::abs(bodies[1].linear_velocity.y - 2.0) < 1e-9);
+
+  std::cout << "  ✓ Friction and restitution tests passed\n";
+}
+
+void test_contact_rolling_resistance() {
+  std::cout << "Testing rolling resistance...\n";
+
+  auto roll = [](double rolling_resistance) {
+    MaterialTable table;
+    const MaterialId mat = table.add(Material{1.0, 0.0, rolling_resistance});
+    const double radius = 0.5;
+    std::vector<RigidBody> bodies(2);
+    bodies[0].material = mat;
+    bodies[1].position = Vec2{0.0, radius};
+    bodies[1].linear_velocity = Vec2{3.0, 0.0};
+    bodies[1].angular_velocity = -3.0 / radius;
+    bodies[1].inv_mass = 1.0;
+    bodies[1].inv_inertia = 1.0 / (0.5 * radius * radius);
+    bodies[1].material = mat;
+
+    ContactSolver solver;
+    const double dt = 1.0 / 60.0;
+    for (int step = 0; step < 120; ++step) {
+      integrate_velocities(bodies, Vec2{0.0, -9.81}, dt);
+      Manifold m;
+      m.normal = Vec2{0.0, 1.0};
+      m.count = 1;
+      m.points[0].point = bodies[1].position - Vec2{0.0, radius};
+      m.points[0].separation = bodies[1].position.y - radius;
+      solver.clear();
+      solver.add(0, 1, m, bodies, table, radius);
+      solver.solve(bodies, dt, 8);
+      integrate_positions(bodies, dt);
+    }
+    return bodies[1].linear_velocity.x;
+  };
+
+  const double free_roll = roll(0.0);
+  const double damped = roll(0.05);
+  assert(std::abs(free_roll - 3.0) < 1e-6);
+  assert(damped < 2.5 && damped > 0.0);
+
+  std::cout << "  ✓ Rolling resistance tests passed\n";
+}
+
+void test_particle_materials() {
+  std::cout << "Testing particle materials...\n";
+
+  MaterialTable table;
+  const MaterialId floor_mat = table.add(Material{0.0, 0.5, 0.0, CombineRule::geometric, CombineRule::min});
+  const MaterialId bouncy = table.add(Material{0.0, 0.9, 0.0, CombineRule::geometric, CombineRule::min});
+  const MaterialId dead = table.add(Material{0.0, 0.0, 0.0, CombineRule::geometric, CombineRule::min});
+
+  Broadphase bp;
+  std::vector<Collider> colliders(1);
+  colliders[0].shape = make_proxy(make_box(10.0, 0.5));
+  colliders[0].transform.p = Vec2{0.0, -0.5};
+  colliders[0].material = floor_mat;
+  attach_collider(colliders, 0, bp);
+
+  ParticleStore ps;
+  ps.add(Vec2{-1.0, 0.05}, Vec2{0.0, -2.0}, 1.0, bouncy);
+  ps.add(Vec2{1.0, 0.05}, Vec2{0.0, -2.0}, 1.0, dead);
+  ps.add(Vec2{3.0, 0.5}, Vec2{0.0, -2.0}, 1.0, bouncy);   // not touching yet
+
+  const std::size_t contacts = collide_particles(ps, CollisionScene{bp, colliders}, table, 0.1);
+  assert(contacts == 2);
+  assert(std::abs(ps.vy[0] - 1.0) < 1e-9);   // min(0.5, 0.9) * 2
+  assert(std::abs(ps.vy[1]) < 1e-9);
+  assert(ps.vy[2] == -2.0);
+  assert(std::abs(ps.y[0] - 0.1) < 1e-9);
+
+  ps.remove(0);
+  assert(ps.size() == 2 && ps.material[0] == bouncy && ps.x[0] == 3.0);
+
+  std::cout << "  ✓ Particle material tests passed\n";
+}
+
+void test_particle_contact_normals() {
+  std::cout << "Testing particle contact normals...\n";
+
+  // Particles entering a box from each side, some with their centre
+  // already inside: pushed out along the face SAT picks, by its depth
+  MaterialTable table;
+  Broadphase bp;
+  std::vector<Collider> colliders(1);
+  colliders[0].shape = make_proxy(make_box(1.0, 1.0));
+  attach_collider(colliders, 0, bp);
+
+  constexpr double radius = 0.1;
+  const Polygon box = make_box(1.0, 1.0);
+  const Polygon square = make_box(radius, radius);  // the particle, face-on
+  const Vec2 starts[] = {{0.95, 0.3}, {-0.95, 0.3}, {0.3, 0.95}, {0.3, -0.95},
+                         {1.05, -0.4}, {-1.05, -0.4}, {-0.4, 1.05}, {-0.4, -1.05}};
+  for (const Vec2& p : starts) {
+    SatCache sat;
+    const Manifold m = collide_polygons(box, Transform2{}, square, Transform2{p, Rot2{}}, sat);
+    assert(m.count > 0);
+    double depth = m.points[0].separation;
+    for (int k = 1; k < m.count; ++k) depth = std::min(depth, m.points[k].separation);
+
+    ParticleStore ps;
+    ps.add(p, -m.normal * 2.0 + m.normal.perpendicular() * 0.5, 1.0, kDefaultMaterial);
+    assert(collide_particles(ps, CollisionScene{bp, colliders}, table, radius) == 1);
+    assert(ps.position(0).distance_to(p - m.normal * depth) < 1e-9);
+    assert(ps.velocity(0).dot(m.normal) >= -1e-9);  // no longer moving in
+  }
+
+  std::cout << "  ✓ Particle contact normal tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Material Tests ===\n\n";
+
+  test_material_table();
+  test_contact_friction_restitution();
+  test_contact_rolling_resistance();
+  test_particle_materials();
+  test_particle_contact_normals();
+
+  std::cout << "\n✓ All material tests passed!\n\n";
+  return 0;
+}
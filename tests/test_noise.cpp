@@ -0,0 +1,133 @@
+#include "../include/math/noise.hpp"
+#include "../include/particles/curl_noise_cache.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace sim;
+
+void test_simplex_gradient() {
+  std::cout << "Testing simplex noise gradient...\n";
+
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> coord(-50.0, 50.0);
+  const double h = 1e-6;
+  double min_v = 0.0, max_v = 0.0;
+  for (int k = 0; k < 2000; ++k) {
+    const double x = coord(rng);
+    const double y = coord(rng);
+    const NoiseSample s = simplex_noise(x, y, 9);
+    const double fdx = (simplex_noise(x + h, y, 9).value - simplex_noise(x - h, y, 9).value) / (2.0 * h);
+    const double fdy = (simplex_noise(x, y + h, 9).value - simplex_noise(x, y - h, 9).value) / (2.0 * h);
+    assert(std::abs(s.dx - fdx) < 1e-5);
+    assert(std::abs(s.dy - fdy) < 1e-5);
+    min_v = std::min(min_v, s.value);
+    max_v = std::max(max_v, s.value);
+  }
+  assert(min_v > -1.1 && max_v < 1.1);
+  assert(min_v < -0.5 && max_v > 0.5);
+
+  // Deterministic, and the seed matters
+  assert(simplex_noise(1.3, 2.7, 4).value == simplex_noise(1.3, 2.7, 4).value);
+  assert(simplex_noise(1.3, 2.7, 4).value != simplex_noise(1.3, 2.7, 5).value);
+
+  std::cout << "  ✓ Simplex gradient tests passed\n";
+}
+
+void test_curl_divergence_free() {
+  std::cout << "Testing curl noise divergence...\n";
+
+  const CurlNoiseParams params{0.7, 3, 2.0, 0.5, 21};
+  const double h = 1e-5;
+  double max_div = 0.0;
+  double max_speed = 0.0;
+  for (int k = 0; k < 500; ++k) {
+    const Vec2 p{0.37 * k - 90.0, 0.11 * k};
+    const double div =
+      (curl_noise(p + Vec2{h, 0.0}, params).x - curl_noise(p - Vec2{h, 0.0}, params).x +
+       curl_noise(p + Vec2{0.0, h}, params).y - curl_noise(p - Vec2{0.0, h}, params).y) / (2.0 * h);
+    max_div = std::max(max_div, std::abs(div));
+    max_speed = std::max(max_speed, curl_noise(p, params).length());
+  }
+  assert(max_div < 1e-4 * max_speed);
+
+  // Batch matches the scalar path
+  std::vector<double> x{0.1, 5.2, -3.3}, y{2.0, -1.0, 7.5};
+  std::vector<double> vx(3, 0.0), vy(3, 0.0);
+  curl_noise_batch(x.data(), y.data(), 3, params, Vec2{}, 2.0, vx.data(), vy.data());
+  for (int i = 0; i < 3; ++i) {
+    const Vec2 v = curl_noise(Vec2{x[i], y[i]}, params) * 2.0;
+    assert(std::abs(vx[i] - v.x) < 1e-12 && std::abs(vy[i] - v.y) < 1e-12);
+  }
+
+  std::cout << "  ✓ Curl divergence tests passed\n";
+}
+
+void test_curl_cache() {
+  std::cout << "Testing curl noise cache...\n";
+
+  const CurlNoiseParams params{0.25, 1, 2.0, 0.5, 5};
+  CurlNoiseCache cache(AABB{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}}, 0.25, params, 0.1);
+  assert(cache.update(0.0));
+  assert(!cache.update(0.05));
+  assert(cache.update(0.1));
+  assert(cache.refreshes() == 2);
+
+  // Close to the exact field at the bake time
+  CurlNoiseCache still(AABB{Vec2{-10.0, -10.0}, Vec2{10.0, 10.0}}, 0.25, params, 0.1);
+  (void)still.update(0.0);
+  double max_err = 0.0, max_speed = 0.0;
+  for (int k = 0; k < 200; ++k) {
+    const Vec2 p{-9.0 + 0.09 * k, 8.0 - 0.07 * k};
+    const Vec2 exact = curl_noise(p, params);
+    max_err = std::max(max_err, (still.sample(p) - exact).length());
+    max_speed = std::max(max_speed, exact.length());
+  }
+  assert(max_err < 0.05 * max_speed);
+
+  // Exact on lattice nodes; clamped outside
+  const Vec2 node{-10.0 + 0.25 * 7, -10.0 + 0.25 * 3};
+  assert((still.sample(node) - curl_noise(node, params)).length() < 1e-9);
+  assert((still.sample(Vec2{-50.0, -50.0}) - still.sample(Vec2{-10.0, -10.0})).length() < 1e-12);
+
+  // A degenerate region still gets one cell and samples inside the lattice
+  CurlNoiseCache line(AABB{Vec2{0.0, 1.0}, Vec2{4.0, 1.0}}, 0.5, params, 0.1);
+  assert(line.node_count() == 9 * 2);
+  (void)line.update(0.0);
+  const Vec2 on_line = line.sample(Vec2{2.0, 1.0});
+  assert(std::isfinite(on_line.x) && std::isfinite(on_line.y));
+  CurlNoiseCache point(AABB{Vec2{1.0, 1.0}, Vec2{1.0, 1.0}}, 0.5, params, 0.1);
+  assert(point.node_count() == 4);
+  (void)point.update(0.0);
+  assert((point.sample(Vec2{-3.0, -2.0}) - point.sample(Vec2{1.0, 1.0})).length() < 1e-12);
+
+  // Non-finite points add nothing and do not disturb their neighbours
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> px{1.0, nan, inf, -inf, 2.0, 3.0};
+  std::vector<double> py{1.0, 0.0, 0.0, 5.0, nan, -4.0};
+  std::vector<double> pvx(6, 0.5), pvy(6, -0.5);
+  still.sample_batch(px.data(), py.data(), 6, 2.0, pvx.data(), pvy.data());
+  for (int k = 1; k < 5; ++k) assert(pvx[k] == 0.5 && pvy[k] == -0.5);
+  for (const int k : {0, 5}) {
+    const Vec2 expected = still.sample(Vec2{px[k], py[k]}) * 2.0 + Vec2{0.5, -0.5};
+    assert(std::abs(pvx[k] - expected.x) < 1e-12 && std::abs(pvy[k] - expected.y) < 1e-12);
+  }
+
+  std::cout << "  ✓ Curl cache tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Noise Tests ===\n\n";
+
+  test_simplex_gradient();
+  test_curl_divergence_free();
+  test_curl_cache();
+
+  std::cout << "\n✓ All noise tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include "../include/core/pool.hpp"
+#include "../include/collision/collider.hpp"
+#include "../include/dynamics/joints.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+int g_live_tracked = 0;
+
+struct Tracked {
+  int value;
+  explicit Tracked(int v) : value(v) { ++g_live_tracked; }
+  ~Tracked() { --g_live_tracked; }
+};
+
+} // namespace
+
+void test_pool_handles() {
+  std::cout << "Testing pool handles...\n";
+
+  Pool<RigidBody> bodies;
+  RigidBody def;
+  def.inv_mass = 1.0;
+  const Handle<RigidBody> a = bodies.create(def);
+  const Handle<RigidBody> b = bodies.create();
+  assert(bodies.size() == 2);
+  assert(bodies.get(a)->inv_mass == 1.0);
+  assert(bodies.get(b)->inv_mass == 0.0);
+
+  RigidBody* pa = bodies.get(a);
+  assert(bodies.destroy(a));
+  assert(!bodies.destroy(a));           // double free is rejected
+  assert(bodies.get(a) == nullptr);     // stale handle
+
+  // The freed slot is reused, but the old handle stays dead
+  const Handle<RigidBody> c = bodies.create();
+  assert(c.index == a.index && c.generation != a.generation);
+  assert(bodies.get(c) == pa);
+  assert(bodies.get(a) == nullptr);
+  assert(bodies.stats().reuses == 1);
+
+  assert(bodies.get(Handle<RigidBody>{}) == nullptr);
+
+  std::cout << "  ✓ Handle tests passed\n";
+}
+
+void test_pool_slabs() {
+  std::cout << "Testing pool slabs...\n";
+
+  Pool<Collider, 16> colliders;
+  std::vector<Handle<Collider>> handles;
+  std::vector<const Collider*> addresses;
+  for (int i = 0; i < 100; ++i) {
+    handles.push_back(colliders.create());
+    addresses.push_back(colliders.get(handles.back()));
+  }
+  // Growth never moves existing objects
+  for (std::size_t i = 0; i < handles.size(); ++i) assert(colliders.get(handles[i]) == addresses[i]);
+  // Slabs start on a cache line
+  for (std::size_t i = 0; i < handles.size(); i += 16) {
+    assert(reinterpret_cast<std::uintptr_t>(addresses[i]) % kCacheLineSize == 0);
+  }
+  const PoolStats& st = colliders.stats();
+  assert(st.slabs == 7 && st.capacity == 112);
+  assert(st.live == 100 && st.peak_live == 100);
+  assert(st.occupancy() > 0.89 && st.occupancy() < 0.9);
+
+  std::cout << "  ✓ Slab tests passed\n";
+}
+
+void test_pool_spawn_cycles() {
+  std::cout << "Testing pool spawn cycles...\n";
+
+  Pool<Tracked> projectiles;
+  projectiles.reserve(256);
+  const std::uint64_t slabs = projectiles.stats().slab_allocations;
+
+  std::vector<Handle<Tracked>> alive;
+  for (int frame = 0; frame < 200; ++frame) {
+    for (int k = 0; k < 20; ++k) alive.push_back(projectiles.create(frame * 100 + k));
+    // Oldest projectiles expire
+    while (alive.size() > 200) {
+      assert(projectiles.destroy(alive.front()));
+      alive.erase(alive.begin());
+    }
+  }
+  assert(projectiles.stats().slab_allocations == slabs);
+  assert(projectiles.size() == 200);
+  assert(g_live_tracked == 200);
+
+  int sum_check = 0;
+  projectiles.for_each([&](Handle<Tracked> h, Tracked& t) {
+    assert(projectiles.get(h) == &t);
+    ++sum_check;
+  });
+  assert(sum_check == 200);
+
+  // Joint defs pool the same way
+  Pool<RevoluteJointDef> joints;
+  const auto j = joints.create();
+  joints.get(j)->enable_motor = true;
+  assert(joints.get(j)->enable_motor);
+
+  Pool<Tracked> moved = std::move(projectiles);
+  assert(moved.size() == 200 && projectiles.empty());
+  moved.clear();
+  assert(g_live_tracked == 0);
+  for (const auto& h : alive) assert(moved.get(h) == nullptr);
+
+  std::cout << "  ✓ Spawn cycle tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Pool Tests ===\n\n";
+
+  test_pool_handles();
+  test_pool_slabs();
+  test_pool_spawn_cycles();
+
+  std::cout << "\n✓ All pool tests passed!\n\n";
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include "../include/collision/sensor.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace sim;
+
+namespace {
+
+struct Scene {
+  Broadphase broadphase{1.0, 0.1};
+  std::vector<Collider> colliders;
+  SensorSystem sensors;
+
+  std::uint32_t add(const ConvexProxy& shape, const Vec2& p, bool sensor) {
+    Collider c{shape, Transform2{p, Rot2{}}};
+    c.is_sensor = sensor;
+    colliders.push_back(c);
+    const auto index = static_cast<std::uint32_t>(colliders.size() - 1);
+    attach_collider(colliders, index, broadphase);
+    return index;
+  }
+
+  void move(std::uint32_t index, const Vec2& p) {
+    colliders[index].set_transform(Transform2{p, Rot2{}}, broadphase);
+  }
+
+  void step() {
+    broadphase.update_pairs();
+    sensors.update(broadphase, colliders);
+  }
+};
+
+} // namespace
+
+void test_sensor_begin_end() {
+  std::cout << "Testing sensor begin/end events...\n";
+
+  Scene scene;
+  const std::uint32_t zone = scene.add(make_proxy(make_box(1.0, 1.0)), Vec2{}, true);
+  const std::uint32_t ball = scene.add(make_circle(Vec2{}, 0.25), Vec2{-5.0, 0.0}, false);
+  scene.step();
+  assert(scene.sensors.events().begin.empty());
+
+  int begins = 0;
+  int ends = 0;
+  int inside_steps = 0;
+  for (int i = 1; i <= 100; ++i) {
+    scene.move(ball, Vec2{-5.0 + 0.1 * i, 0.0});
+    scene.step();
+    const SensorEvents& ev = scene.sensors.events();
+    begins += static_cast<int>(ev.begin.size());
+    ends += static_cast<int>(ev.end.size());
+    if (!ev.begin.empty()) {
+      assert((ev.begin[0] == SensorEvent{zone, ball}));
+      // Ball edge reaches the box face at x = -1
+      assert(std::abs(scene.colliders[ball].transform.p.x + 1.25) < 0.1 + 1e-9);
+    }
+    int overlaps = 0;
+    scene.sensors.for_each_overlap([&](const SensorEvent&) { ++overlaps; });
+    inside_steps += overlaps;
+  }
+  assert(begins == 1);
+  assert(ends == 1);
+  assert(inside_steps > 20 && inside_steps < 30);
+
+  std::cout << "  ✓ Begin/end tests passed\n";
+}
+
+void test_sensor_incremental() {
+  std::cout << "Testing sensor incremental cost...\n";
+
+  Scene scene;
+  // A field of pickups; only one of them is near the player
+  for (int i = 0; i < 1000; ++i) {
+    scene.add(make_circle(Vec2{}, 0.3), Vec2{3.0 * (i % 40), 3.0 * (i / 40) + 10.0}, true);
+  }
+  const std::uint32_t pickup = scene.add(make_circle(Vec2{}, 0.3), Vec2{0.0, 0.0}, true);
+  const std::uint32_t player = scene.add(make_proxy(make_box(0.4, 0.4)), Vec2{0.5, 0.0}, false);
+  scene.step();
+  assert(scene.sensors.events().begin.size() == 1);
+  assert(scene.sensors.candidate_count() == 1);
+
+  // Idle world: no overlap tests at all
+  const std::uint64_t tests = scene.sensors.narrow_tests();
+  for (int i = 0; i < 50; ++i) scene.step();
+  assert(scene.sensors.narrow_tests() == tests);
+
+  // Player jitters inside its fat box: one test per step, no events
+  for (int i = 0; i < 10; ++i) {
+    scene.move(player, Vec2{0.5 + 0.001 * i, 0.0});
+    scene.step();
+    assert(scene.sensors.events().begin.empty() && scene.sensors.events().end.empty());
+  }
+  assert(scene.sensors.narrow_tests() == tests + 10);
+
+  // Sensors never report each other
+  scene.add(make_circle(Vec2{}, 0.3), Vec2{0.2, 0.0}, true);
+  scene.step();
+  assert(scene.sensors.events().begin.size() == 1);
+  assert(scene.sensors.events().begin[0].visitor == player);
+
+  // Destroying the visitor ends the overlap
+  scene.broadphase.destroy_proxy(scene.colliders[player].proxy);
+  scene.step();
+  assert(scene.sensors.events().end.size() == 2);
+  assert(scene.sensors.events().end[0].visitor == player);
+  assert(scene.sensors.events().end[0].sensor == pickup ||
+         scene.sensors.events().end[1].sensor == pickup);
+  assert(scene.sensors.candidate_count() == 0);
+
+  std::cout << "  ✓ Incremental tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Sensor Tests ===\n\n";
+
+  test_sensor_begin_end();
+  test_sensor_incremental();
+
+  std::cout << "\n✓ All sensor tests passed!\n\n";
+  return 0;
+}
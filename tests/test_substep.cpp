@@ -0,0 +1,132 @@
+#include "../include/particles/selective_substep.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace sim;
+
+namespace {
+
+double kinetic_energy(const ParticleStore& ps) {
+  double e = 0.0;
+  for (std::size_t i = 0; i < ps.size(); ++i) {
+    if (ps.inv_mass[i] > 0.0) e += 0.5 * (ps.vx[i] * ps.vx[i] + ps.vy[i] * ps.vy[i]) / ps.inv_mass[i];
+  }
+  return e;
+}
+
+/// A resting lattice of particles with gaps between them
+void add_lattice(ParticleStore& ps, int nx, int ny, double spacing, const Vec2& origin) {
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) ps.add(origin + Vec2{i * spacing, j * spacing});
+  }
+}
+
+} // namespace
+
+void test_substep_head_on() {
+  std::cout << "Testing sub-stepped head-on collision...\n";
+
+  const double dt = 1.0 / 60.0;
+  SubstepConfig cfg;
+  cfg.radius = 0.1;
+  cfg.stiffness = 2.0e4;
+  cfg.substeps = 16;
+
+  ParticleStore ps;
+  ps.add(Vec2{-0.5, 0.0}, Vec2{12.0, 0.0});
+  ps.add(Vec2{0.5, 0.0}, Vec2{-12.0, 0.0});
+  add_lattice(ps, 10, 10, 0.5, Vec2{20.0, 20.0});  // far away, at rest
+  const double e0 = kinetic_energy(ps);
+
+  SelectiveSubstepper stepper(cfg);
+  for (int s = 0; s < 30; ++s) {
+    stepper.step(ps, Vec2{}, dt);
+    if (s == 0) assert(stepper.stats().hot == 2);
+  }
+
+  // Elastic springs: the pair bounces apart with its energy intact
+  assert(ps.vx[0] < -11.0 && ps.vx[1] > 11.0);
+  assert(std::abs(kinetic_energy(ps) - e0) < 0.05 * e0);
+  // The lattice never moved
+  for (std::size_t i = 2; i < ps.size(); ++i) assert(ps.vx[i] == 0.0 && ps.vy[i] == 0.0);
+
+  // Without sub-steps the same collision is badly wrong
+  ParticleStore coarse;
+  coarse.add(Vec2{-0.5, 0.0}, Vec2{12.0, 0.0});
+  coarse.add(Vec2{0.5, 0.0}, Vec2{-12.0, 0.0});
+  cfg.substeps = 1;
+  SelectiveSubstepper single(cfg);
+  for (int s = 0; s < 30; ++s) single.step(coarse, Vec2{}, dt);
+  const bool coarse_ok = coarse.vx[0] < -11.0 && coarse.vx[1] > 11.0 &&
+                         std::abs(kinetic_energy(coarse) - e0) < 0.05 * e0;
+  assert(!coarse_ok);
+
+  std::cout << "  ✓ Head-on collision tests passed\n";
+}
+
+void test_substep_halo_exchange() {
+  std::cout << "Testing halo momentum exchange...\n";
+
+  SubstepConfig cfg;
+  cfg.radius = 0.1;
+  cfg.substeps = 16;
+
+  // A fast particle hits a resting one: the slow one is halo, not hot
+  ParticleStore ps;
+  ps.add(Vec2{-0.3, 0.0}, Vec2{10.0, 0.0});
+  ps.add(Vec2{0.0, 0.0});
+  const double p0 = ps.vx[0] + ps.vx[1];
+
+  SelectiveSubstepper stepper(cfg);
+  stepper.step(ps, Vec2{}, 1.0 / 60.0);
+  assert(stepper.stats().hot == 1);
+  assert(stepper.stats().halo == 1);
+  for (int s = 0; s < 20; ++s) stepper.step(ps, Vec2{}, 1.0 / 60.0);
+
+  // Momentum is conserved and transferred to the resting particle
+  assert(std::abs(ps.vx[0] + ps.vx[1] - p0) < 1e-9);
+  assert(ps.vx[1] > 5.0);
+  assert(ps.vx[0] < 5.0);
+
+  std::cout << "  ✓ Halo exchange tests passed\n";
+}
+
+void test_substep_cost() {
+  std::cout << "Testing selective sub-step cost...\n";
+
+  SubstepConfig cfg;
+  cfg.radius = 0.05;
+  cfg.substeps = 8;
+
+  // Large calm pile plus a small explosion in one corner
+  ParticleStore ps;
+  add_lattice(ps, 100, 100, 0.2, Vec2{});
+  for (int k = 0; k < 16; ++k) {
+    const double a = k * 0.3926990816987241;
+    ps.add(Vec2{5.1 + 0.02 * std::cos(a), 5.1 + 0.02 * std::sin(a)},
+           Vec2{20.0 * std::cos(a), 20.0 * std::sin(a)});
+  }
+
+  SelectiveSubstepper stepper(cfg);
+  stepper.step(ps, Vec2{}, 1.0 / 60.0);
+  const SubstepStats& st = stepper.stats();
+  assert(st.hot == 16);
+  assert(st.halo > 0 && st.halo < 50);
+  // Global sub-stepping would update all 10k particles 8 times
+  assert(st.substep_updates == (st.hot + st.halo) * 8);
+  assert(st.substep_updates < ps.size() / 10);
+
+  std::cout << "  ✓ Cost tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Selective Substep Tests ===\n\n";
+
+  test_substep_head_on();
+  test_substep_halo_exchange();
+  test_substep_cost();
+
+  std::cout << "\n✓ All selective substep tests passed!\n\n";
+  return 0;
+}
@@ -1,6 +1,7 @@
 #include "../include/math/vec2.hpp"
 #include <cassert>
 #include <cmath>
+#include <type_traits>
 #include <iostream>
 
 using namespace sim;
@@ -213,6 +214,27 @@ void test_vec2_lerp() {
   std::cout << "  ✓ Lerp tests passed\n";
 }
 
+void test_vec2_mixed_factors() {
+  std::cout << "Testing Vec2 mixed-type factors...\n";
+
+  // Built-in components take the factor in their own type: no narrowing
+  // of a double into a float vector, and the result stays float
+  using FVec2 = BasicVec2<float>;
+  FVec2 f{1.0f, 2.0f};
+  static_assert(std::is_same_v<decltype(f * 2.0), FVec2>);
+  const FVec2 g = f * 2.0 + 0.5 * f - f / 2.0;
+  assert(g.x == 2.0f && g.y == 4.0f);
+  f *= 3.0;
+  f /= 1.5;
+  assert(f.x == 2.0f && f.y == 4.0f);
+
+  // Integer factors on a double vector; integer vectors reject fractions
+  assert((Vec2{1.5, 2.0} * 2).x == 3.0);
+  static_assert(VecFactor<int, int> && VecFactor<double, float> && !VecFactor<double, int>);
+
+  std::cout << "  ✓ Mixed-type factor tests passed\n";
+}
+
 int main() {
   std::cout << "\n=== Running Vec2 Tests ===\n\n";
   
@@ -227,6 +249,7 @@ int main() {
   test_vec2_distance();
   test_vec2_perpendicular();
   test_vec2_lerp();
+  test_vec2_mixed_factors();
   
   std::cout << "\n✓ All Vec2 tests passed!\n\n";
   return 0;
@@ -0,0 +1,156 @@
+#include "../include/particles/vector_env.hpp"
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+using namespace sim;
+
+// Count heap allocations so the test can check step() makes none
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+} // namespace
+
+// GCC flags malloc/free inside a replaced operator new/delete as mismatched
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size > 0 ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+VectorEnvConfig small_config() {
+  VectorEnvConfig cfg;
+  cfg.envs = 20;                 // not a multiple of the lane count
+  cfg.world.particles = 8;
+  cfg.horizon = 50;
+  return cfg;
+}
+
+struct Buffers {
+  std::vector<double> obs, actions, reward;
+  std::vector<std::uint8_t> done;
+
+  explicit Buffers(const VectorEnv<>& env)
+      : obs(env.num_envs() * env.obs_dim()), actions(env.num_envs() * env.action_dim(), 0.0),
+        reward(env.num_envs()), done(env.num_envs()) {}
+};
+
+} // namespace
+
+void test_vector_env_reset() {
+  std::cout << "Testing vector env reset...\n";
+
+  VectorEnv<> env(small_config());
+  assert(env.num_envs() == 20);
+  assert(env.obs_dim() == 4 + 2 * 8);
+  Buffers buf(env);
+  env.reset(buf.obs, 7);
+
+  for (std::size_t e = 0; e < env.num_envs(); ++e) {
+    const double* o = &buf.obs[e * env.obs_dim()];
+    // Targets lie inside the middle half of the box
+    const Vec2 t = env.target(e);
+    assert(t.x >= 0.25 && t.x <= 0.75 && t.y >= 0.25 && t.y <= 0.75);
+    // Particle offsets are relative to the centre, so they sum to zero
+    double sx = 0.0, sy = 0.0;
+    for (std::size_t i = 0; i < 8; ++i) {
+      sx += o[4 + 2 * i];
+      sy += o[5 + 2 * i];
+    }
+    assert(std::abs(sx) < 1e-12 && std::abs(sy) < 1e-12);
+  }
+  // Environments get different episodes
+  assert(buf.obs[0] != buf.obs[env.obs_dim()]);
+
+  // Same seed, same observations
+  VectorEnv<> again(small_config());
+  Buffers buf2(again);
+  again.reset(buf2.obs, 7);
+  assert(buf.obs == buf2.obs);
+
+  std::cout << "  ✓ Vector env reset tests passed\n";
+}
+
+void test_vector_env_step() {
+  std::cout << "Testing vector env step...\n";
+
+  TaskPool pool(2);
+  VectorEnv<> env(small_config(), &pool);
+  Buffers buf(env);
+  env.reset(buf.obs, 3);
+
+  // Push every environment towards its target with a proportional policy
+  auto policy = [&] {
+    for (std::size_t e = 0; e < env.num_envs(); ++e) {
+      const double* o = &buf.obs[e * env.obs_dim()];
+      buf.actions[2 * e] = -2.0 * o[0] - 0.5 * o[2];
+      buf.actions[2 * e + 1] = 0.5 - 2.0 * o[1] - 0.5 * o[3];   // 0.5 ~ gravity / max_accel
+    }
+  };
+
+  const std::size_t before = g_allocations.load();
+  double first_reward = 0.0, last_reward = 0.0;
+  for (int s = 0; s < 30; ++s) {
+    policy();
+    env.step(buf.actions, buf.obs, buf.reward, buf.done);
+    if (s == 0) first_reward = buf.reward[0];
+    if (buf.done[0] == 0) last_reward = buf.reward[0];
+  }
+  assert(g_allocations.load() == before);   // step() never touches the heap
+  assert(last_reward > first_reward);       // the policy closes in
+
+  std::cout << "  ✓ Vector env step tests passed\n";
+}
+
+void test_vector_env_auto_reset() {
+  std::cout << "Testing vector env auto-reset...\n";
+
+  VectorEnvConfig cfg = small_config();
+  cfg.horizon = 5;
+  cfg.success_radius = 0.0;      // episodes only end by the horizon
+  VectorEnv<> env(cfg);
+  Buffers buf(env);
+  env.reset(buf.obs, 11);
+  const Vec2 first_target = env.target(4);
+
+  for (int s = 1; s <= 5; ++s) {
+    env.step(buf.actions, buf.obs, buf.reward, buf.done);
+    for (std::uint8_t d : buf.done) assert(d == (s == 5 ? 1 : 0));
+  }
+  // The step that ended the episode already returned the next episode's
+  // first observation, with a new target
+  assert(env.episodes(4) == 1);
+  assert(env.target(4) != first_target);
+  assert(env.batch(0).steps(4) == 0);
+  const double* o = &buf.obs[4 * env.obs_dim()];
+  const Vec2 c = env.target(4) + Vec2{o[0], o[1]};
+  assert(c.y > 0.5);             // freshly seeded in the upper half
+
+  // The next step continues the new episode
+  env.step(buf.actions, buf.obs, buf.reward, buf.done);
+  for (std::uint8_t d : buf.done) assert(d == 0);
+
+  std::cout << "  ✓ Vector env auto-reset tests passed\n";
+}
+
+int main() {
+  std::cout << "=== Running Vector Env Tests ===\n\n";
+
+  test_vector_env_reset();
+  test_vector_env_step();
+  test_vector_env_auto_reset();
+
+  std::cout << "\n✓ All vector env tests passed!\n\n";
+  return 0;
+}
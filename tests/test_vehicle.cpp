@@ -0,0 +1,125 @@
+#include "../include/vehicle/vehicle_batch.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace sim;
+
+namespace {
+
+constexpr double kDt = 1.0 / 60.0;
+
+void run(VehicleBatch& batch, int steps, int substeps = 8) {
+  for (int i = 0; i < steps; ++i) batch.step(kDt, substeps);
+}
+
+} // namespace
+
+void test_vehicle_acceleration() {
+  std::cout << "Testing vehicle acceleration...\n";
+
+  VehicleBatch batch;
+  batch.add(VehicleParams{}, Vec2{});
+  batch.set_input(0, VehicleInput{.throttle = 1.0});
+
+  run(batch, 180);
+  assert(batch.vx[0] > 5.0);
+  assert(batch.position(0).x > 5.0);
+  assert(std::abs(batch.position(0).y) < 1e-9);
+  assert(std::abs(batch.heading(0)) < 1e-9);
+
+  // Driven rear wheel spins at least as fast as the ground speed
+  assert(batch.rear_spin[0] * 0.3 >= batch.vx[0] - 1e-6);
+
+  std::cout << "  ✓ Acceleration tests passed\n";
+}
+
+void test_vehicle_braking() {
+  std::cout << "Testing vehicle braking...\n";
+
+  VehicleBatch batch;
+  batch.add(VehicleParams{}, Vec2{});
+  batch.set_input(0, VehicleInput{.throttle = 1.0});
+  run(batch, 180);
+  const double speed = batch.vx[0];
+
+  batch.set_input(0, VehicleInput{.brake = 1.0});
+  run(batch, 30);
+  assert(batch.vx[0] < speed);
+  run(batch, 600);
+  assert(std::abs(batch.vx[0]) < 0.5);
+  assert(std::isfinite(batch.front_spin[0]) && std::isfinite(batch.rear_spin[0]));
+
+  std::cout << "  ✓ Braking tests passed\n";
+}
+
+void test_vehicle_steering() {
+  std::cout << "Testing vehicle steering...\n";
+
+  VehicleBatch batch;
+  batch.add(VehicleParams{}, Vec2{});
+  batch.set_input(0, VehicleInput{.throttle = 0.5});
+  run(batch, 120);
+
+  batch.set_input(0, VehicleInput{.throttle = 0.3, .steer = 0.5});
+  run(batch, 60);
+  assert(batch.yaw_rate[0] > 0.0);
+  assert(batch.heading(0) > 0.1);
+  assert(batch.position(0).y > 0.0);
+
+  std::cout << "  ✓ Steering tests passed\n";
+}
+
+void test_vehicle_batch_consistency() {
+  std::cout << "Testing vehicle batch consistency...\n";
+
+  // Every lane of a large batch matches a vehicle simulated alone
+  VehicleBatch single;
+  single.add(VehicleParams{}, Vec2{});
+  single.set_input(0, VehicleInput{.throttle = 0.8, .steer = 0.2});
+
+  VehicleBatch many;
+  for (int i = 0; i < 1000; ++i) {
+    many.add(VehicleParams{}, Vec2{});
+    many.set_input(i, VehicleInput{.throttle = 0.8, .steer = 0.2});
+  }
+
+  run(single, 120);
+  run(many, 120);
+  for (std::size_t i = 0; i < many.size(); ++i) {
+    assert(many.x[i] == single.x[0] && many.y[i] == single.y[0]);
+    assert(many.yaw_rate[i] == single.yaw_rate[0]);
+  }
+
+  std::cout << "  ✓ Batch consistency tests passed\n";
+}
+
+void test_vehicle_substep_convergence() {
+  std::cout << "Testing drivetrain substep convergence...\n";
+
+  VehicleBatch coarse;
+  VehicleBatch fine;
+  coarse.add(VehicleParams{}, Vec2{});
+  fine.add(VehicleParams{}, Vec2{});
+  coarse.set_input(0, VehicleInput{.throttle = 1.0});
+  fine.set_input(0, VehicleInput{.throttle = 1.0});
+
+  run(coarse, 120, 8);
+  run(fine, 120, 32);
+  assert(std::abs(coarse.vx[0] - fine.vx[0]) < 0.05 * fine.vx[0]);
+
+  std::cout << "  ✓ Substep convergence tests passed\n";
+}
+
+int main() {
+  std::cout << "\n=== Running Vehicle Tests ===\n\n";
+
+  test_vehicle_acceleration();
+  test_vehicle_braking();
+  test_vehicle_steering();
+  test_vehicle_batch_consistency();
+  test_vehicle_substep_convergence();
+
+  std::cout << "\n✓ All vehicle tests passed!\n\n";
+  return 0;
+}